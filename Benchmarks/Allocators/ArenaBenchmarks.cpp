@@ -0,0 +1,59 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Allocators/Arena.h>
+#include <memory_resource>
+#include <vector>
+
+using namespace EA::Bench;
+
+//Simulates per-block scratch memory: every iteration reserves a few temporary
+//vectors of state.size floats and throws them away.
+//"std" allocates them with new/delete, "std_monotonic" uses a
+//std::pmr::monotonic_buffer_resource created per block.
+namespace
+{
+constexpr int numScratchBuffers = 4;
+
+float processBlock(std::pmr::memory_resource& resource, int size)
+{
+    auto sum = 0.f;
+
+    for (int buffer = 0; buffer < numScratchBuffers; ++buffer)
+    {
+        auto scratch = std::pmr::vector<float>(&resource);
+        scratch.reserve((size_t) size);
+        scratch.push_back((float) buffer);
+        sum += scratch.back();
+    }
+
+    return sum;
+}
+} // namespace
+
+auto arenaScratchEA = benchmark("Arena.scratch/EA", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto arena = EA::Allocators::Arena();
+
+    while (state.keepRunning())
+    {
+        auto scope = EA::Allocators::ArenaScope(arena);
+        doNotOptimize(processBlock(arena, state.size));
+    }
+};
+
+auto arenaScratchStd = benchmark("Arena.scratch/std", {64, 512, 4096}) =
+    [](State& state)
+{
+    while (state.keepRunning())
+        doNotOptimize(processBlock(*std::pmr::new_delete_resource(), state.size));
+};
+
+auto arenaScratchMonotonic =
+    benchmark("Arena.scratch/std_monotonic", {64, 512, 4096}) = [](State& state)
+{
+    while (state.keepRunning())
+    {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        doNotOptimize(processBlock(resource, state.size));
+    }
+};
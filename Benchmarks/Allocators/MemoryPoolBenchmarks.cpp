@@ -0,0 +1,178 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Allocators/ConcurrentPoolResource.h>
+#include <ea_data_structures/Allocators/MultiPoolAllocator.h>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace EA::Bench;
+
+//Allocates state.size blocks of blockSize bytes, then frees them in a
+//different order than they were allocated. "std" is plain operator new/delete
+//and "std_pool" is std::pmr::unsynchronized_pool_resource.
+namespace
+{
+constexpr size_t blockSize = 64;
+
+template <typename Allocate, typename Free>
+void allocateAndFree(State& state, Allocate allocate, Free free)
+{
+    auto blocks = std::vector<void*>((size_t) state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        for (auto& block: blocks)
+            block = allocate();
+
+        for (size_t index = 0; index < blocks.size(); index += 2)
+            free(blocks[index]);
+
+        for (size_t index = 1; index < blocks.size(); index += 2)
+            free(blocks[index]);
+
+        clobberMemory();
+    }
+}
+} // namespace
+
+auto memoryPoolEA = benchmark("MemoryPool.allocate_free/EA", {64, 4096}) =
+    [](State& state)
+{
+    auto pool = EA::Allocators::MemoryPool((int) blockSize, state.size);
+
+    allocateAndFree(
+        state,
+        [&] { return pool.allocate(blockSize); },
+        [&](void* block) { pool.deallocate(block, blockSize); });
+};
+
+auto memoryPoolStd = benchmark("MemoryPool.allocate_free/std", {64, 4096}) =
+    [](State& state)
+{
+    allocateAndFree(
+        state,
+        [] { return ::operator new(blockSize); },
+        [](void* block) { ::operator delete(block); });
+};
+
+auto memoryPoolStdPool = benchmark("MemoryPool.allocate_free/std_pool", {64, 4096}) =
+    [](State& state)
+{
+    auto resource = std::pmr::unsynchronized_pool_resource();
+
+    allocateAndFree(
+        state,
+        [&] { return resource.allocate(blockSize); },
+        [&](void* block) { resource.deallocate(block, blockSize); });
+};
+
+//Mixed sizes between 8 and 1024 bytes, through a memory_resource
+namespace
+{
+void allocateMixed(State& state, std::pmr::memory_resource& resource)
+{
+    auto blocks = std::vector<std::pair<void*, size_t>>((size_t) state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        for (size_t index = 0; index < blocks.size(); ++index)
+        {
+            auto bytes = (size_t) 8 << (index % 8);
+            blocks[index] = {resource.allocate(bytes), bytes};
+        }
+
+        for (auto& [block, bytes]: blocks)
+            resource.deallocate(block, bytes);
+
+        clobberMemory();
+    }
+}
+} // namespace
+
+auto multiPoolEA = benchmark("MultiPool.mixed_sizes/EA", {64, 4096}) =
+    [](State& state)
+{
+    auto resource = EA::Allocators::MultiPoolResource();
+    allocateMixed(state, resource);
+};
+
+auto multiPoolStd = benchmark("MultiPool.mixed_sizes/std", {64, 4096}) =
+    [](State& state)
+{
+    allocateMixed(state, *std::pmr::new_delete_resource());
+};
+
+auto multiPoolStdPool = benchmark("MultiPool.mixed_sizes/std_pool", {64, 4096}) =
+    [](State& state)
+{
+    auto resource = std::pmr::unsynchronized_pool_resource();
+    allocateMixed(state, resource);
+};
+
+//The size is the number of threads, each allocating and freeing short-lived
+//buffers of 64 to 512 bytes through a shared resource. "std_sync_pool" is
+//std::pmr::synchronized_pool_resource.
+namespace
+{
+constexpr int buffersPerThread = 8192;
+
+void workerBuffers(State& state, std::pmr::memory_resource& resource)
+{
+    state.setItemsPerIteration((long long) state.size * buffersPerThread);
+
+    while (state.keepRunning())
+    {
+        auto threads = std::vector<std::thread>();
+
+        for (int thread = 0; thread < state.size; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    void* live[4] = {};
+
+                    for (int index = 0; index < buffersPerThread; ++index)
+                    {
+                        auto slot = index % 4;
+                        auto bytes = (size_t) 64 << slot;
+
+                        if (live[slot] != nullptr)
+                            resource.deallocate(live[slot], bytes);
+
+                        live[slot] = resource.allocate(bytes);
+                    }
+
+                    for (int slot = 0; slot < 4; ++slot)
+                        resource.deallocate(live[slot], (size_t) 64 << slot);
+                });
+        }
+
+        for (auto& thread: threads)
+            thread.join();
+    }
+}
+} // namespace
+
+auto concurrentPoolEA =
+    benchmark("ConcurrentPool.worker_buffers/EA", {1, 2, 4, 8}) = [](State& state)
+{
+    auto resource = EA::Allocators::ConcurrentPoolResource();
+    workerBuffers(state, resource);
+};
+
+auto concurrentPoolStd =
+    benchmark("ConcurrentPool.worker_buffers/std", {1, 2, 4, 8}) = [](State& state)
+{
+    workerBuffers(state, *std::pmr::new_delete_resource());
+};
+
+auto concurrentPoolStdSync =
+    benchmark("ConcurrentPool.worker_buffers/std_sync_pool", {1, 2, 4, 8}) =
+        [](State& state)
+{
+    auto resource = std::pmr::synchronized_pool_resource();
+    workerBuffers(state, resource);
+};
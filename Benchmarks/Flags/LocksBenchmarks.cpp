@@ -0,0 +1,162 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Flags/Locks.h>
+#include <ea_data_structures/Flags/RecursiveSpinLock.h>
+#include <ea_data_structures/Flags/SeqLock.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace EA::Bench;
+
+//state.size threads each taking the lock operationsPerThread times around a
+//tiny critical section. The std equivalent is std::mutex.
+//Fair locks hand over in a fixed order, which costs more than it gains when
+//there are fewer cores than threads: the numbers mean the most on machines
+//with at least state.size cores.
+namespace
+{
+constexpr int operationsPerThread = 5000;
+
+template <typename Lock>
+void contend(State& state)
+{
+    state.setItemsPerIteration(state.size * operationsPerThread);
+
+    while (state.keepRunning())
+    {
+        auto lock = Lock();
+        auto counter = 0;
+        auto threads = std::vector<std::thread>();
+
+        for (int thread = 0; thread < state.size; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    for (int index = 0; index < operationsPerThread; ++index)
+                    {
+                        auto guard = std::lock_guard(lock);
+                        ++counter;
+                    }
+                });
+        }
+
+        for (auto& thread: threads)
+            thread.join();
+
+        doNotOptimize(counter);
+    }
+}
+
+//A small parameter block read by state.size threads, one access in
+//writeEvery being a write
+constexpr int writeEvery = 64;
+
+struct Params
+{
+    float values[8] {};
+};
+
+template <typename Read, typename Write>
+void readMostly(State& state, Read read, Write write)
+{
+    state.setItemsPerIteration(state.size * operationsPerThread);
+
+    while (state.keepRunning())
+    {
+        auto threads = std::vector<std::thread>();
+
+        for (int thread = 0; thread < state.size; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    auto sum = 0.f;
+
+                    for (int index = 0; index < operationsPerThread; ++index)
+                    {
+                        if (index % writeEvery == 0)
+                            write((float) index);
+                        else
+                            sum += read();
+                    }
+
+                    doNotOptimize(sum);
+                });
+        }
+
+        for (auto& thread: threads)
+            thread.join();
+    }
+}
+
+template <typename Lock, typename SharedGuard>
+void readMostlyLocked(State& state)
+{
+    auto lock = Lock();
+    auto params = Params();
+
+    readMostly(
+        state,
+        [&]
+        {
+            auto guard = SharedGuard(lock);
+            return params.values[3];
+        },
+        [&](float value)
+        {
+            auto guard = std::lock_guard(lock);
+            params.values[3] = value;
+        });
+}
+} // namespace
+
+auto locksContendedSpin = benchmark("Locks.contended/EA_spin", {1, 4}) =
+    [](State& state) { contend<EA::Locks::PrimitiveSpinLock>(state); };
+
+auto locksContendedRecursive = benchmark("Locks.contended/EA_recursive", {1, 4}) =
+    [](State& state) { contend<EA::Locks::RecursiveSpinLock>(state); };
+
+auto locksContendedTicket = benchmark("Locks.contended/EA_ticket", {1, 4}) =
+    [](State& state) { contend<EA::Locks::TicketLock>(state); };
+
+auto locksContendedMCS = benchmark("Locks.contended/EA_mcs", {1, 4}) =
+    [](State& state) { contend<EA::Locks::MCSLock>(state); };
+
+auto locksContendedSpinThenBlock =
+    benchmark("Locks.contended/EA_spin_then_block", {1, 4}) =
+        [](State& state) { contend<EA::Locks::SpinThenBlockLock>(state); };
+
+auto locksContendedStd = benchmark("Locks.contended/std", {1, 4}) =
+    [](State& state) { contend<std::mutex>(state); };
+
+auto locksReadMostlyReadWrite = benchmark("Locks.read_mostly/EA_rw", {1, 4}) =
+    [](State& state)
+{
+    using Lock = EA::Locks::ReadWriteSpinLock;
+    readMostlyLocked<Lock, EA::Locks::ScopedSharedSpinLock<Lock>>(state);
+};
+
+auto locksReadMostlySpin = benchmark("Locks.read_mostly/EA_spin", {1, 4}) =
+    [](State& state)
+{
+    using Lock = EA::Locks::PrimitiveSpinLock;
+    readMostlyLocked<Lock, EA::Locks::ScopedSpinLock<Lock>>(state);
+};
+
+auto locksReadMostlySeqLock = benchmark("Locks.read_mostly/EA_seqlock", {1, 4}) =
+    [](State& state)
+{
+    auto shared = EA::Locks::SeqLock<Params>();
+
+    readMostly(
+        state,
+        [&] { return shared.load().values[3]; },
+        [&](float value)
+        { shared.modify([value](Params& params) { params.values[3] = value; }); });
+};
+
+auto locksReadMostlyStd = benchmark("Locks.read_mostly/std", {1, 4}) =
+    [](State& state)
+{ readMostlyLocked<std::shared_mutex, std::shared_lock<std::shared_mutex>>(state); };
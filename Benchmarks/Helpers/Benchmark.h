@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace EA::Bench
+{
+using Clock = std::chrono::steady_clock;
+
+//Passed to every benchmark body. Setup code goes before the
+//`while (state.keepRunning())` loop and is not timed; only the loop is.
+//size is the problem size the benchmark was registered with.
+class State
+{
+public:
+    State(int sizeToUse, long long iterationsToRun)
+        : size(sizeToUse)
+        , iterations(iterationsToRun)
+    {
+    }
+
+    bool keepRunning() noexcept
+    {
+        if (remaining == iterations)
+            start = Clock::now();
+
+        if (remaining-- > 0)
+            return true;
+
+        end = Clock::now();
+        return false;
+    }
+
+    //How many logical items one iteration handles, so results can also be
+    //reported per item (per element pushed, per lookup, ...)
+    void setItemsPerIteration(long long items) noexcept
+    {
+        itemsPerIteration = items;
+    }
+
+    double getElapsedNanoseconds() const noexcept
+    {
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    long long getIterations() const noexcept { return iterations; }
+    long long getItemsPerIteration() const noexcept { return itemsPerIteration; }
+
+    const int size;
+
+private:
+    long long iterations;
+    long long remaining = iterations;
+    long long itemsPerIteration = 1;
+    Clock::time_point start {};
+    Clock::time_point end {};
+};
+
+using Body = std::function<void(State&)>;
+
+//A benchmark name is "<Group>/<Implementation>", for example "Vector.add/EA"
+//and "Vector.add/std". The runner pairs entries sharing a group so every EA
+//container is reported next to its std equivalent.
+struct Entry
+{
+    std::string name;
+    std::vector<int> sizes;
+    Body body;
+};
+
+inline std::vector<Entry>& getRegistry()
+{
+    static std::vector<Entry> registry;
+    return registry;
+}
+
+struct Registrar
+{
+    bool operator=(Body body)
+    {
+        getRegistry().push_back({name, sizes, std::move(body)});
+        return true;
+    }
+
+    std::string name;
+    std::vector<int> sizes;
+};
+
+inline Registrar benchmark(const std::string& name, std::initializer_list<int> sizes)
+{
+    return {name, sizes};
+}
+
+//Keeps the optimizer from discarding a value computed inside a benchmark loop
+template <typename T>
+void doNotOptimize(const T& value) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    static const void* volatile sink = nullptr;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    __asm__ __volatile__("" : : "r"(&value) : "memory");
+#endif
+}
+
+//Forces the compiler to assume all memory may have been read or written
+inline void clobberMemory() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    _ReadWriteBarrier();
+#else
+    __asm__ __volatile__("" : : : "memory");
+#endif
+}
+} // namespace EA::Bench
@@ -0,0 +1,262 @@
+#include <Helpers/Benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+//Runs every registered benchmark and prints a table, optionally writing the
+//results as JSON so they can be diffed between releases.
+//
+//Usage: ea_data_structures_bench [--filter <text>] [--json <file|->]
+//                                [--min-time <ms>] [--repetitions <n>]
+namespace
+{
+using namespace EA::Bench;
+
+struct Options
+{
+    std::string filter;
+    std::string jsonPath;
+    double minTimeMs = 100.0;
+    int repetitions = 3;
+};
+
+struct Result
+{
+    std::string name;
+    std::string group;
+    std::string implementation;
+    int size = 0;
+    long long iterations = 0;
+    long long itemsPerIteration = 1;
+    double nsPerIteration = 0.0;
+
+    double nsPerItem() const { return nsPerIteration / (double) itemsPerIteration; }
+};
+
+Options parseOptions(int argc, char** argv)
+{
+    auto options = Options();
+
+    for (int index = 1; index < argc; ++index)
+    {
+        auto arg = std::string(argv[index]);
+        auto hasValue = index + 1 < argc;
+
+        if (arg == "--filter" && hasValue)
+            options.filter = argv[++index];
+        else if (arg == "--json" && hasValue)
+            options.jsonPath = argv[++index];
+        else if (arg == "--min-time" && hasValue)
+            options.minTimeMs = std::atof(argv[++index]);
+        else if (arg == "--repetitions" && hasValue)
+            options.repetitions = std::max(1, std::atoi(argv[++index]));
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            std::exit(1);
+        }
+    }
+
+    return options;
+}
+
+double runOnce(const Entry& entry, int size, long long iterations, long long& items)
+{
+    auto state = State(size, iterations);
+    entry.body(state);
+    items = state.getItemsPerIteration();
+
+    return state.getElapsedNanoseconds();
+}
+
+//Grows the iteration count until one run takes at least minTime, then keeps
+//the fastest of several runs at that count
+Result run(const Entry& entry, int size, const Options& options)
+{
+    auto minTimeNs = options.minTimeMs * 1e6;
+    auto items = 1LL;
+    auto iterations = 1LL;
+    auto elapsed = runOnce(entry, size, iterations, items);
+
+    while (elapsed < minTimeNs)
+    {
+        auto scale = elapsed > 0.0 ? minTimeNs * 1.2 / elapsed : 100.0;
+        auto growth = std::clamp(scale, 2.0, 100.0);
+        auto next = (long long) ((double) iterations * growth);
+
+        iterations = std::max(iterations + 1, next);
+        elapsed = runOnce(entry, size, iterations, items);
+    }
+
+    for (int rep = 1; rep < options.repetitions; ++rep)
+        elapsed = std::min(elapsed, runOnce(entry, size, iterations, items));
+
+    auto separator = entry.name.find('/');
+    auto result = Result();
+
+    result.name = entry.name;
+    result.group = entry.name.substr(0, separator);
+
+    if (separator != std::string::npos)
+        result.implementation = entry.name.substr(separator + 1);
+
+    result.size = size;
+    result.iterations = iterations;
+    result.itemsPerIteration = items;
+    result.nsPerIteration = elapsed / (double) iterations;
+
+    return result;
+}
+
+const Result* findBaseline(const std::vector<Result>& results, const Result& result)
+{
+    for (auto& other: results)
+    {
+        if (other.group == result.group && other.size == result.size
+            && other.implementation == "std")
+            return &other;
+    }
+
+    return nullptr;
+}
+
+void printTable(const std::vector<Result>& results)
+{
+    std::printf("%-44s %9s %14s %12s %10s\n",
+                "Benchmark",
+                "Size",
+                "ns/iteration",
+                "ns/item",
+                "vs std");
+
+    for (auto& result: results)
+    {
+        std::printf("%-44s %9d %14.2f %12.3f",
+                    result.name.c_str(),
+                    result.size,
+                    result.nsPerIteration,
+                    result.nsPerItem());
+
+        auto* baseline = findBaseline(results, result);
+
+        if (baseline != nullptr && baseline != &result)
+            std::printf(" %9.2fx", result.nsPerIteration / baseline->nsPerIteration);
+
+        std::printf("\n");
+    }
+}
+
+std::string escape(const std::string& text)
+{
+    auto escaped = std::string();
+
+    for (auto c: text)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+std::string getCompiler()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+void writeJson(std::ostream& stream, const std::vector<Result>& results)
+{
+#if defined(NDEBUG)
+    auto buildType = "release";
+#else
+    auto buildType = "debug";
+#endif
+
+    stream << "{\n  \"context\": {\n";
+    stream << "    \"build_type\": \"" << buildType << "\",\n";
+    stream << "    \"compiler\": \"" << escape(getCompiler()) << "\"\n";
+    stream << "  },\n  \"benchmarks\": [";
+
+    for (size_t index = 0; index < results.size(); ++index)
+    {
+        auto& result = results[index];
+
+        stream << (index == 0 ? "\n" : ",\n");
+        stream << "    {\"name\": \"" << escape(result.name) << "\", ";
+        stream << "\"group\": \"" << escape(result.group) << "\", ";
+        stream << "\"implementation\": \"" << escape(result.implementation)
+               << "\", ";
+        stream << "\"size\": " << result.size << ", ";
+        stream << "\"iterations\": " << result.iterations << ", ";
+        stream << "\"items_per_iteration\": " << result.itemsPerIteration << ", ";
+        stream << "\"ns_per_iteration\": " << result.nsPerIteration << ", ";
+        stream << "\"ns_per_item\": " << result.nsPerItem() << "}";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto options = parseOptions(argc, argv);
+    auto results = std::vector<Result>();
+
+#if !defined(NDEBUG)
+    std::cerr << "Warning: benchmarks were built without optimizations\n";
+#endif
+
+    for (auto& entry: getRegistry())
+    {
+        if (entry.name.find(options.filter) == std::string::npos)
+            continue;
+
+        for (auto size: entry.sizes)
+            results.push_back(run(entry, size, options));
+    }
+
+    std::stable_sort(results.begin(),
+                     results.end(),
+                     [](const Result& first, const Result& second)
+                     {
+                         if (first.group != second.group)
+                             return first.group < second.group;
+
+                         return first.size < second.size;
+                     });
+
+    if (options.jsonPath == "-")
+    {
+        writeJson(std::cout, results);
+        return 0;
+    }
+
+    printTable(results);
+
+    if (!options.jsonPath.empty())
+    {
+        auto file = std::ofstream(options.jsonPath);
+
+        if (!file)
+        {
+            std::cerr << "Can't open " << options.jsonPath << " for writing\n";
+            return 1;
+        }
+
+        writeJson(file, results);
+    }
+
+    return 0;
+}
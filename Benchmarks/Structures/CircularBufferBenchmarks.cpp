@@ -0,0 +1,179 @@
+#include <Helpers/Benchmark.h>
+#include <cmath>
+#include <ea_data_structures/Structures/CircularBuffer.h>
+#include <ea_data_structures/Structures/CircularInterpolation.h>
+#include <vector>
+
+using namespace EA::Bench;
+
+//A delay line: every sample is written once and read back through a few
+//taps. The std version does the same wrapping by hand over a std::vector.
+namespace
+{
+constexpr int numTaps = 4;
+constexpr int blockSize = 512;
+
+int getTapDelay(int tap, int size)
+{
+    return (tap + 1) * size / (numTaps + 1);
+}
+
+//A chorus voice: the delay swings around a quarter of the buffer
+std::vector<float> getChorusDelays(int size)
+{
+    auto delays = std::vector<float>(blockSize);
+
+    for (int index = 0; index < blockSize; ++index)
+    {
+        auto swing = 20.f * std::sin((float) index * 0.01f);
+        delays[(size_t) index] = (float) size / 4.f + swing;
+    }
+
+    return delays;
+}
+
+template <EA::CircularIndexing Indexing>
+void runDelayTaps(State& state)
+{
+    auto buffer = EA::CircularBuffer<float, Indexing>(state.size);
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        auto output = 0.f;
+
+        for (int sample = 0; sample < blockSize; ++sample, ++writePos)
+        {
+            buffer[writePos] = (float) sample;
+
+            for (int tap = 0; tap < numTaps; ++tap)
+                output += buffer[writePos - getTapDelay(tap, state.size)];
+        }
+
+        doNotOptimize(output);
+    }
+}
+} // namespace
+
+auto circularDelayEA = benchmark("CircularBuffer.delay_taps/EA", {1024, 65536}) =
+    [](State& state) { runDelayTaps<EA::CircularIndexing::Modulo>(state); };
+
+auto circularDelayMasked =
+    benchmark("CircularBuffer.delay_taps/EA_power_of_two", {1024, 65536}) =
+        [](State& state) { runDelayTaps<EA::CircularIndexing::PowerOfTwo>(state); };
+
+auto circularDelayStd = benchmark("CircularBuffer.delay_taps/std", {1024, 65536}) =
+    [](State& state)
+{
+    auto buffer = std::vector<float>((size_t) state.size);
+    auto size = state.size;
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        auto output = 0.f;
+
+        for (int sample = 0; sample < blockSize; ++sample, ++writePos)
+        {
+            buffer[(size_t) (writePos % size)] = (float) sample;
+
+            for (int tap = 0; tap < numTaps; ++tap)
+            {
+                auto readPos = writePos - getTapDelay(tap, size);
+                output += buffer[(size_t) ((readPos % size + size) % size)];
+            }
+        }
+
+        doNotOptimize(output);
+    }
+};
+
+//Writing a whole block into the delay line as two contiguous copies through
+//write(), against the element by element loop through operator[] ("std")
+auto circularBlockEA = benchmark("CircularBuffer.block_write/EA", {1024, 65536}) =
+    [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size);
+    auto block = std::vector<float>(blockSize, 1.f);
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        buffer.write(writePos, {block.data(), blockSize});
+        writePos += blockSize - 1;
+        doNotOptimize(buffer[writePos]);
+    }
+};
+
+auto circularBlockStd = benchmark("CircularBuffer.block_write/std", {1024, 65536}) =
+    [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size);
+    auto block = std::vector<float>(blockSize, 1.f);
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        for (int index = 0; index < blockSize; ++index)
+            buffer[writePos + index] = block[(size_t) index];
+
+        writePos += blockSize - 1;
+        doNotOptimize(buffer[writePos]);
+    }
+};
+
+//Reading a block at modulated fractional delays with Hermite interpolation:
+//readInterpolated() against the per-sample loop through operator[] ("std")
+auto circularChorusEA =
+    benchmark("CircularBuffer.chorus_hermite/EA", {1024, 65536}) = [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size, 1.f);
+    auto delays = getChorusDelays(state.size);
+    auto output = std::vector<float>(blockSize);
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    auto delayView = EA::BufferView<const float>(delays.data(), blockSize);
+
+    while (state.keepRunning())
+    {
+        EA::readInterpolated<EA::Interpolators::Hermite>(
+            buffer, writePos, delayView, {output.data(), blockSize});
+
+        writePos += blockSize;
+        doNotOptimize(output.data());
+    }
+};
+
+auto circularChorusStd =
+    benchmark("CircularBuffer.chorus_hermite/std", {1024, 65536}) = [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size, 1.f);
+    auto delays = getChorusDelays(state.size);
+    auto output = std::vector<float>(blockSize);
+    auto writePos = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        for (int index = 0; index < blockSize; ++index)
+        {
+            auto position = (float) (writePos + index) - delays[(size_t) index];
+            auto whole = (int) std::floor(position);
+            float points[] = {buffer[whole - 1],
+                              buffer[whole],
+                              buffer[whole + 1],
+                              buffer[whole + 2]};
+
+            output[(size_t) index] = EA::Interpolators::Hermite::interpolate(
+                points, position - (float) whole);
+        }
+
+        writePos += blockSize;
+        doNotOptimize(output.data());
+    }
+};
@@ -0,0 +1,89 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/AtomicCopyOnWrite.h>
+#include <ea_data_structures/Structures/CopyOnWrite.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace EA::Bench;
+
+//state.size threads all reading the same snapshot readsPerThread times.
+//The std equivalent copies a shared_ptr under a mutex (the portable way to
+//read one another thread may replace), and EA is a plain CopyOnWrite copy,
+//which pays for the shared reference count but isn't safe to replace.
+//The contention only shows on machines with several cores.
+namespace
+{
+constexpr int readsPerThread = 10000;
+
+struct Settings
+{
+    int values[16] {};
+};
+
+template <typename Read>
+void readFromThreads(State& state, Read read)
+{
+    state.setItemsPerIteration(state.size * readsPerThread);
+
+    while (state.keepRunning())
+    {
+        auto threads = std::vector<std::thread>();
+
+        for (int thread = 0; thread < state.size; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    auto sum = 0;
+
+                    for (int index = 0; index < readsPerThread; ++index)
+                        sum += read();
+
+                    doNotOptimize(sum);
+                });
+        }
+
+        for (auto& thread: threads)
+            thread.join();
+    }
+}
+} // namespace
+
+auto copyOnWriteReadAtomic =
+    benchmark("CopyOnWrite.read/EA_atomic", {1, 4}) = [](State& state)
+{
+    auto shared = EA::AtomicCopyOnWrite<Settings>();
+    readFromThreads(state, [&] { return shared.load()->values[0]; });
+};
+
+auto copyOnWriteReadEA = benchmark("CopyOnWrite.read/EA", {1, 4}) =
+    [](State& state)
+{
+    auto shared = EA::CopyOnWrite<Settings>();
+
+    readFromThreads(state,
+                    [&]
+                    {
+                        auto copy = shared;
+                        return copy->values[0];
+                    });
+};
+
+auto copyOnWriteReadStd = benchmark("CopyOnWrite.read/std", {1, 4}) =
+    [](State& state)
+{
+    auto shared = std::make_shared<const Settings>();
+    auto mutex = std::mutex();
+
+    readFromThreads(state,
+                    [&]
+                    {
+                        auto lock = std::unique_lock(mutex);
+                        auto copy = shared;
+                        lock.unlock();
+
+                        return copy->values[0];
+                    });
+};
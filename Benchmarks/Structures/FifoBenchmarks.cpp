@@ -0,0 +1,51 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/Fifo.h>
+#include <ea_data_structures/Structures/Vector.h>
+#include <mutex>
+
+using namespace EA::Bench;
+
+//Fifo shares a big object between threads. The std equivalent is the usual
+//mutex-guarded copy. Both are measured uncontended, on a single thread.
+namespace
+{
+using Payload = EA::Vector<float>;
+} // namespace
+
+auto fifoPushPullEA = benchmark("Fifo.push_pull/EA", {16, 512, 4096}) =
+    [](State& state)
+{
+    auto fifo = EA::Fifo<Payload>();
+    auto payload = Payload(state.size);
+    fifo.fill(payload);
+
+    while (state.keepRunning())
+    {
+        fifo.push(payload);
+        doNotOptimize(fifo.pull());
+    }
+};
+
+auto fifoPushPullStd = benchmark("Fifo.push_pull/std", {16, 512, 4096}) =
+    [](State& state)
+{
+    auto mutex = std::mutex();
+    auto shared = Payload(state.size);
+    auto reader = Payload(state.size);
+    auto payload = Payload(state.size);
+
+    while (state.keepRunning())
+    {
+        {
+            auto lock = std::lock_guard(mutex);
+            shared = payload;
+        }
+
+        {
+            auto lock = std::lock_guard(mutex);
+            reader = shared;
+        }
+
+        doNotOptimize(reader);
+    }
+};
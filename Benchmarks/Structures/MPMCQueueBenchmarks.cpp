@@ -0,0 +1,130 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Flags/Locks.h>
+#include <ea_data_structures/Structures/MPMCQueue.h>
+#include <ea_data_structures/Structures/Vector.h>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace EA::Bench;
+
+//The size is the number of threads. Every thread pushes a value and then pops
+//one, opsPerThread times, all sharing one queue.
+//"EA" is MPMCQueue, "EA_spinlock_vector" is a Vector behind a
+//PrimitiveSpinLock (used as a stack) and "std" is a mutex-guarded std::deque.
+namespace
+{
+constexpr int opsPerThread = 16384;
+
+template <typename Queue, typename Push, typename Pop>
+void pushPop(State& state, Push push, Pop pop)
+{
+    auto numThreads = state.size;
+    state.setItemsPerIteration((long long) numThreads * opsPerThread);
+
+    while (state.keepRunning())
+    {
+        auto queue = Queue();
+        auto threads = std::vector<std::thread>();
+
+        for (int thread = 0; thread < numThreads; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    auto sum = 0LL;
+                    auto value = 0;
+
+                    for (int op = 0; op < opsPerThread; ++op)
+                    {
+                        while (!push(queue, op))
+                            std::this_thread::yield();
+
+                        while (!pop(queue, value))
+                            std::this_thread::yield();
+
+                        sum += value;
+                    }
+
+                    doNotOptimize(sum);
+                });
+        }
+
+        for (auto& thread: threads)
+            thread.join();
+    }
+}
+
+struct SpinLockedVector
+{
+    EA::Locks::PrimitiveSpinLock lock;
+    EA::Vector<int> items;
+};
+
+struct LockedDeque
+{
+    std::mutex mutex;
+    std::deque<int> items;
+};
+
+using Queue = EA::MPMCQueue<int, 1024>;
+} // namespace
+
+auto mpmcQueuePushPopEA =
+    benchmark("MPMCQueue.push_pop/EA", {1, 2, 4, 8, 16, 32}) = [](State& state)
+{
+    pushPop<Queue>(
+        state,
+        [](Queue& q, int value) { return q.tryPush(value); },
+        [](Queue& q, int& value) { return q.tryPop(value); });
+};
+
+auto mpmcQueuePushPopSpinLock =
+    benchmark("MPMCQueue.push_pop/EA_spinlock_vector", {1, 2, 4, 8, 16, 32}) =
+        [](State& state)
+{
+    pushPop<SpinLockedVector>(
+        state,
+        [](SpinLockedVector& q, int value)
+        {
+            auto lock = EA::Locks::ScopedSpinLock(q.lock);
+            q.items.add(value);
+            return true;
+        },
+        [](SpinLockedVector& q, int& value)
+        {
+            auto lock = EA::Locks::ScopedSpinLock(q.lock);
+
+            if (q.items.empty())
+                return false;
+
+            value = q.items.back();
+            q.items.pop_back();
+            return true;
+        });
+};
+
+auto mpmcQueuePushPopStd =
+    benchmark("MPMCQueue.push_pop/std", {1, 2, 4, 8, 16, 32}) = [](State& state)
+{
+    pushPop<LockedDeque>(
+        state,
+        [](LockedDeque& q, int value)
+        {
+            auto lock = std::lock_guard(q.mutex);
+            q.items.push_back(value);
+            return true;
+        },
+        [](LockedDeque& q, int& value)
+        {
+            auto lock = std::lock_guard(q.mutex);
+
+            if (q.items.empty())
+                return false;
+
+            value = q.items.front();
+            q.items.pop_front();
+            return true;
+        });
+};
@@ -0,0 +1,253 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/FlatHashMap.h>
+#include <ea_data_structures/Structures/MapVector.h>
+#include <ea_data_structures/Structures/SortedMapVector.h>
+#include <ea_data_structures/Structures/SplitMapVector.h>
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace EA::Bench;
+
+//MapVector ("EA"), SortedMapVector ("EA_sorted"), SplitMapVector ("EA_split")
+//and FlatHashMap ("EA_flat_hash") are compared against std::map ("std") and
+//std::unordered_map ("std_unordered")
+namespace
+{
+template <typename MapType>
+void insert(State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto map = MapType();
+
+        for (int key = 0; key < state.size; ++key)
+            map[key] = key;
+
+        doNotOptimize(map);
+    }
+}
+
+//Keys are looked up in a shuffled order so node-based maps don't get to walk
+//memory in allocation order
+std::vector<int> getShuffledKeys(int size)
+{
+    auto keys = std::vector<int>((size_t) size);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(size));
+
+    return keys;
+}
+
+template <typename MapType>
+void lookup(State& state)
+{
+    auto map = MapType();
+    auto keys = getShuffledKeys(state.size);
+
+    for (int key = 0; key < state.size; ++key)
+        map[key] = key;
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto key: keys)
+            sum += map[key];
+
+        doNotOptimize(sum);
+    }
+}
+
+//A value big enough that interleaving it with the keys hurts key scans
+struct LargeValue
+{
+    float data[32] {};
+};
+
+template <typename MapType>
+void lookupLargeValue(State& state)
+{
+    auto map = MapType();
+
+    for (int key = 0; key < state.size; ++key)
+        map[key].data[0] = (float) key;
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0.f;
+
+        for (int key = 0; key < state.size; ++key)
+            sum += map[key].data[0];
+
+        doNotOptimize(sum);
+    }
+}
+
+template <typename MapType>
+void iterate(State& state)
+{
+    auto map = MapType();
+
+    for (int key = 0; key < state.size; ++key)
+        map[key] = key;
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto& element: map)
+            sum += element.second;
+
+        doNotOptimize(sum);
+    }
+}
+} // namespace
+
+auto mapVectorInsertEA = benchmark("MapVector.insert/EA", {16, 256, 4096}) =
+    [](State& state)
+{
+    insert<EA::MapVector<int, int>>(state);
+};
+
+auto mapVectorInsertFlatHash =
+    benchmark("MapVector.insert/EA_flat_hash", {16, 256, 4096, 65536}) =
+        [](State& state)
+{
+    insert<EA::FlatHashMap<int, int>>(state);
+};
+
+auto mapVectorInsertStd = benchmark("MapVector.insert/std", {16, 256, 4096}) =
+    [](State& state)
+{
+    insert<std::map<int, int>>(state);
+};
+
+auto mapVectorInsertUnordered =
+    benchmark("MapVector.insert/std_unordered", {16, 256, 4096, 65536}) =
+        [](State& state)
+{
+    insert<std::unordered_map<int, int>>(state);
+};
+
+auto mapVectorLookupEA = benchmark("MapVector.lookup/EA", {16, 256, 4096}) =
+    [](State& state)
+{
+    lookup<EA::MapVector<int, int>>(state);
+};
+
+auto mapVectorLookupSorted =
+    benchmark("MapVector.lookup/EA_sorted", {16, 256, 4096}) = [](State& state)
+{
+    lookup<EA::SortedMapVector<int, int>>(state);
+};
+
+auto mapVectorLookupSplit =
+    benchmark("MapVector.lookup/EA_split", {16, 256, 4096}) = [](State& state)
+{
+    lookup<EA::SplitMapVector<int, int>>(state);
+};
+
+auto mapVectorLookupFlatHash =
+    benchmark("MapVector.lookup/EA_flat_hash", {16, 256, 4096, 65536}) =
+        [](State& state)
+{
+    lookup<EA::FlatHashMap<int, int>>(state);
+};
+
+auto mapVectorLookupStd = benchmark("MapVector.lookup/std", {16, 256, 4096}) =
+    [](State& state)
+{
+    lookup<std::map<int, int>>(state);
+};
+
+auto mapVectorLookupUnordered =
+    benchmark("MapVector.lookup/std_unordered", {16, 256, 4096, 65536}) =
+        [](State& state)
+{
+    lookup<std::unordered_map<int, int>>(state);
+};
+
+auto mapVectorLookupLargeEA =
+    benchmark("MapVector.lookup_large_value/EA", {16, 256, 4096}) = [](State& state)
+{
+    lookupLargeValue<EA::MapVector<int, LargeValue>>(state);
+};
+
+auto mapVectorLookupLargeSplit =
+    benchmark("MapVector.lookup_large_value/EA_split", {16, 256, 4096}) =
+        [](State& state)
+{
+    lookupLargeValue<EA::SplitMapVector<int, LargeValue>>(state);
+};
+
+auto mapVectorLookupLargeStd =
+    benchmark("MapVector.lookup_large_value/std", {16, 256, 4096}) = [](State& state)
+{
+    lookupLargeValue<std::map<int, LargeValue>>(state);
+};
+
+auto mapVectorIterateEA = benchmark("MapVector.iterate/EA", {16, 256, 4096}) =
+    [](State& state)
+{
+    iterate<EA::MapVector<int, int>>(state);
+};
+
+auto mapVectorIterateStd = benchmark("MapVector.iterate/std", {16, 256, 4096}) =
+    [](State& state)
+{
+    iterate<std::map<int, int>>(state);
+};
+
+auto mapVectorIterateUnordered =
+    benchmark("MapVector.iterate/std_unordered", {16, 256, 4096}) = [](State& state)
+{
+    iterate<std::unordered_map<int, int>>(state);
+};
+
+auto mapVectorInsertBatchSorted =
+    benchmark("MapVector.insert_batch/EA_sorted", {256, 4096, 65536}) =
+        [](State& state)
+{
+    auto pairs = std::vector<std::pair<int, int>>();
+
+    for (int key = state.size - 1; key >= 0; --key)
+        pairs.emplace_back(key, key);
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto map = EA::SortedMapVector<int, int>();
+        map.insertBatch(pairs);
+        doNotOptimize(map);
+    }
+};
+
+auto mapVectorInsertBatchStd =
+    benchmark("MapVector.insert_batch/std", {256, 4096, 65536}) = [](State& state)
+{
+    auto pairs = std::vector<std::pair<int, int>>();
+
+    for (int key = state.size - 1; key >= 0; --key)
+        pairs.emplace_back(key, key);
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto map = std::map<int, int>(pairs.begin(), pairs.end());
+        doNotOptimize(map);
+    }
+};
@@ -0,0 +1,72 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/CircularBuffer.h>
+#include <ea_data_structures/Structures/MirroredCircularBuffer.h>
+
+using namespace EA::Bench;
+
+//Flipping the sign of a block of the ring at a moving position, so some blocks
+//cross its end: in one SIMD call over a mirrored window, over the two
+//segments of a CircularBuffer, or element by element ("std")
+namespace
+{
+constexpr int blockSize = 512;
+
+void runWindowGain(State& state, bool allowMirroring)
+{
+    auto buffer = EA::MirroredCircularBuffer<float>(state.size, 1.f, allowMirroring);
+    auto position = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        auto window = buffer.getWindow(position, blockSize);
+        window.applyGain(-1.f);
+        doNotOptimize(window.begin());
+        position += blockSize - 3;
+    }
+}
+} // namespace
+
+auto mirroredGain =
+    benchmark("MirroredCircularBuffer.window_gain/EA", {1024, 65536}) =
+        [](State& state) { runWindowGain(state, true); };
+
+auto mirroredGainFallback =
+    benchmark("MirroredCircularBuffer.window_gain/EA_fallback", {1024, 65536}) =
+        [](State& state) { runWindowGain(state, false); };
+
+auto mirroredGainSegments =
+    benchmark("MirroredCircularBuffer.window_gain/EA_segments", {1024, 65536}) =
+        [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size, 1.f);
+    auto position = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        auto segments = buffer.getSegments(position, blockSize);
+        segments.first.applyGain(-1.f);
+        segments.second.applyGain(-1.f);
+        doNotOptimize(segments.first.begin());
+        position += blockSize - 3;
+    }
+};
+
+auto mirroredGainStd =
+    benchmark("MirroredCircularBuffer.window_gain/std", {1024, 65536}) =
+        [](State& state)
+{
+    auto buffer = EA::CircularBuffer<float>(state.size, 1.f);
+    auto position = 0;
+    state.setItemsPerIteration(blockSize);
+
+    while (state.keepRunning())
+    {
+        for (int index = 0; index < blockSize; ++index)
+            buffer[position + index] *= -1.f;
+
+        doNotOptimize(buffer[position]);
+        position += blockSize - 3;
+    }
+};
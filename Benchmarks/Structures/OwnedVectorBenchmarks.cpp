@@ -0,0 +1,127 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/OwnedVector.h>
+#include <memory>
+#include <vector>
+
+using namespace EA::Bench;
+
+namespace
+{
+struct Item
+{
+    explicit Item(int valueToUse)
+        : value(valueToUse)
+    {
+    }
+
+    int value = 0;
+    float padding[7] {};
+};
+} // namespace
+
+auto ownedVectorCreateEA = benchmark("OwnedVector.create/EA", {16, 1024, 65536}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::OwnedVector<Item>();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.createNew(index);
+
+        doNotOptimize(vec);
+    }
+};
+
+auto ownedVectorCreateStd = benchmark("OwnedVector.create/std", {16, 1024, 65536}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<std::unique_ptr<Item>>();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.emplace_back(std::make_unique<Item>(index));
+
+        doNotOptimize(vec);
+    }
+};
+
+auto ownedVectorIterateEA = benchmark("OwnedVector.iterate/EA", {1024, 65536}) =
+    [](State& state)
+{
+    auto vec = EA::OwnedVector<Item>();
+
+    for (int index = 0; index < state.size; ++index)
+        vec.createNew(index);
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto& item: vec)
+            sum += item->value;
+
+        doNotOptimize(sum);
+    }
+};
+
+auto ownedVectorIterateStd = benchmark("OwnedVector.iterate/std", {1024, 65536}) =
+    [](State& state)
+{
+    auto vec = std::vector<std::unique_ptr<Item>>();
+
+    for (int index = 0; index < state.size; ++index)
+        vec.emplace_back(std::make_unique<Item>(index));
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto& item: vec)
+            sum += item->value;
+
+        doNotOptimize(sum);
+    }
+};
+
+//Pushes empty pointers, so only the vector's own growth is measured
+auto ownedVectorGrowEA = benchmark("OwnedVector.grow/EA", {1024, 100000}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::OwnedVector<Item>();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.create();
+
+        doNotOptimize(vec);
+    }
+};
+
+auto ownedVectorGrowStd = benchmark("OwnedVector.grow/std", {1024, 100000}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<std::unique_ptr<Item>>();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.emplace_back();
+
+        doNotOptimize(vec);
+    }
+};
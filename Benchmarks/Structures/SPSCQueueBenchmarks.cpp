@@ -0,0 +1,105 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/SPSCQueue.h>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace EA::Bench;
+
+//Moves state.size messages from a producer thread to a consumer thread.
+//The std equivalent is a mutex-guarded std::deque. Each iteration starts its
+//own consumer thread, so the smaller sizes include that overhead as well.
+//Both sides yield when the queue is full/empty so the benchmark stays
+//meaningful on machines with few cores.
+namespace
+{
+constexpr int queueCapacity = 1024;
+
+template <typename Queue, typename Push, typename Pop>
+void transfer(State& state, Queue& queue, Push push, Pop pop)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto consumer = std::thread(
+            [&]
+            {
+                auto sum = 0LL;
+                auto value = 0;
+
+                for (int received = 0; received < state.size;)
+                {
+                    if (pop(queue, value))
+                    {
+                        sum += value;
+                        ++received;
+                    }
+                    else
+                        std::this_thread::yield();
+                }
+
+                doNotOptimize(sum);
+            });
+
+        for (int index = 0; index < state.size;)
+        {
+            if (push(queue, index))
+                ++index;
+            else
+                std::this_thread::yield();
+        }
+
+        consumer.join();
+    }
+}
+
+struct LockedDeque
+{
+    std::mutex mutex;
+    std::deque<int> items;
+};
+} // namespace
+
+auto spscQueueTransferEA =
+    benchmark("SPSCQueue.transfer/EA", {4096, 65536, 1048576}) = [](State& state)
+{
+    auto queue = EA::SPSCQueue<int, queueCapacity>();
+
+    transfer(
+        state,
+        queue,
+        [](auto& q, int value) { return q.tryPush(value); },
+        [](auto& q, int& value) { return q.tryPop(value); });
+};
+
+auto spscQueueTransferStd =
+    benchmark("SPSCQueue.transfer/std", {4096, 65536, 1048576}) = [](State& state)
+{
+    auto queue = LockedDeque();
+
+    transfer(
+        state,
+        queue,
+        [](LockedDeque& q, int value)
+        {
+            auto lock = std::lock_guard(q.mutex);
+
+            if ((int) q.items.size() == queueCapacity)
+                return false;
+
+            q.items.push_back(value);
+            return true;
+        },
+        [](LockedDeque& q, int& value)
+        {
+            auto lock = std::lock_guard(q.mutex);
+
+            if (q.items.empty())
+                return false;
+
+            value = q.items.front();
+            q.items.pop_front();
+            return true;
+        });
+};
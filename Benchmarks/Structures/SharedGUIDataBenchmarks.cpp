@@ -0,0 +1,111 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/SharedGUIData.h>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace EA::Bench;
+
+//The realtime side of sharing a large parameter block: state.size reads, each
+//summing the block, while a writer thread keeps changing it. The std
+//equivalent guards the block with a mutex the reader has to lock. The writer
+//yields after every change so the benchmark stays meaningful on machines
+//with few cores.
+namespace
+{
+using Params = std::array<float, 256>;
+
+float sum(const Params& params)
+{
+    auto total = 0.f;
+
+    for (auto value: params)
+        total += value;
+
+    return total;
+}
+
+template <typename Write, typename Read>
+void readWhileWriting(State& state, Write write, Read read)
+{
+    auto done = std::atomic<bool>(false);
+
+    auto writer = std::thread(
+        [&]
+        {
+            for (int change = 0; !done; ++change)
+            {
+                write((float) change);
+                std::this_thread::yield();
+            }
+        });
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        for (int index = 0; index < state.size; ++index)
+            doNotOptimize(read());
+    }
+
+    done = true;
+    writer.join();
+}
+} // namespace
+
+auto sharedReadLeftRight =
+    benchmark("SharedWithRealTime.read_while_writing/EA_left_right", {1, 64}) =
+        [](State& state)
+{
+    auto shared = EA::SharedWithRealTimeMultiWriter<Params>();
+
+    readWhileWriting(
+        state,
+        [&](float value)
+        { shared.modify([value](Params& params) { params[0] = value; }); },
+        [&] { return sum(*shared.getRealTime()); });
+};
+
+auto sharedReadFifo =
+    benchmark("SharedWithRealTime.read_while_writing/EA_fifo", {1, 64}) =
+        [](State& state)
+{
+    auto shared = EA::SharedWithRealTime<Params>();
+    auto writeLock = std::mutex();
+
+    readWhileWriting(
+        state,
+        [&](float value)
+        {
+            auto lock = std::lock_guard(writeLock);
+            (*shared)[0] = value;
+            shared.push();
+        },
+        [&]
+        {
+            shared.blockStarted();
+            return sum(shared.getRealTime());
+        });
+};
+
+auto sharedReadStd =
+    benchmark("SharedWithRealTime.read_while_writing/std", {1, 64}) =
+        [](State& state)
+{
+    auto params = Params();
+    auto mutex = std::mutex();
+
+    readWhileWriting(
+        state,
+        [&](float value)
+        {
+            auto lock = std::lock_guard(mutex);
+            params[0] = value;
+        },
+        [&]
+        {
+            auto lock = std::lock_guard(mutex);
+            return sum(params);
+        });
+};
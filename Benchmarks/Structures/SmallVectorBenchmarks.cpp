@@ -0,0 +1,71 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/SmallVector.h>
+#include <vector>
+
+using namespace EA::Bench;
+
+//Sizes straddle the inline capacity of 32 so both the static and the
+//dynamic representation are measured
+namespace
+{
+template <typename VectorType>
+void addElements(State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = VectorType();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.push_back(index);
+
+        doNotOptimize(vec);
+    }
+}
+
+template <typename VectorType>
+void sumByIndex(State& state)
+{
+    auto vec = VectorType();
+
+    for (int index = 0; index < state.size; ++index)
+        vec.push_back(index);
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (int index = 0; index < state.size; ++index)
+            sum += vec[index];
+
+        doNotOptimize(sum);
+    }
+}
+} // namespace
+
+auto smallVectorAddEA = benchmark("SmallVector.add/EA", {8, 32, 1024}) =
+    [](State& state)
+{
+    addElements<EA::SmallVector<int, 32>>(state);
+};
+
+auto smallVectorAddStd = benchmark("SmallVector.add/std", {8, 32, 1024}) =
+    [](State& state)
+{
+    addElements<std::vector<int>>(state);
+};
+
+auto smallVectorIndexEA = benchmark("SmallVector.index/EA", {32, 1024}) =
+    [](State& state)
+{
+    sumByIndex<EA::SmallVector<int, 32>>(state);
+};
+
+auto smallVectorIndexStd = benchmark("SmallVector.index/std", {32, 1024}) =
+    [](State& state)
+{
+    sumByIndex<std::vector<int>>(state);
+};
@@ -0,0 +1,116 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/StaticVector.h>
+#include <vector>
+
+using namespace EA::Bench;
+
+namespace
+{
+constexpr int capacity = 4096;
+
+//The std equivalent of a StaticVector is a std::vector reserved up front
+template <typename VectorType>
+void fillVector(VectorType& vec, int size)
+{
+    for (int index = 0; index < size; ++index)
+        vec.push_back(index);
+}
+} // namespace
+
+auto staticVectorAddEA = benchmark("StaticVector.add/EA", {16, 256, capacity}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::StaticVector<int, capacity>();
+        fillVector(vec, state.size);
+        doNotOptimize(vec);
+    }
+};
+
+auto staticVectorAddStd = benchmark("StaticVector.add/std", {16, 256, capacity}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<int>();
+        vec.reserve(capacity);
+        fillVector(vec, state.size);
+        doNotOptimize(vec);
+    }
+};
+
+auto staticVectorIterateEA = benchmark("StaticVector.iterate/EA", {256, capacity}) =
+    [](State& state)
+{
+    auto vec = EA::StaticVector<int, capacity>();
+    fillVector(vec, state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto element: vec)
+            sum += element;
+
+        doNotOptimize(sum);
+    }
+};
+
+auto staticVectorIterateStd =
+    benchmark("StaticVector.iterate/std", {256, capacity}) = [](State& state)
+{
+    auto vec = std::vector<int>();
+    fillVector(vec, state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (auto element: vec)
+            sum += element;
+
+        doNotOptimize(sum);
+    }
+};
+
+auto staticVectorRemoveEA = benchmark("StaticVector.removeAt_front/EA", {16, 256}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::StaticVector<int, capacity>();
+        fillVector(vec, state.size);
+
+        while (!vec.empty())
+            vec.removeAt(0);
+
+        doNotOptimize(vec);
+    }
+};
+
+auto staticVectorRemoveStd =
+    benchmark("StaticVector.removeAt_front/std", {16, 256}) = [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<int>();
+        vec.reserve(capacity);
+        fillVector(vec, state.size);
+
+        while (!vec.empty())
+            vec.erase(vec.begin());
+
+        doNotOptimize(vec);
+    }
+};
@@ -0,0 +1,263 @@
+#include <Helpers/Benchmark.h>
+#include <ea_data_structures/Structures/SpecialVectors.h>
+#include <ea_data_structures/Structures/Vector.h>
+#include <numeric>
+#include <vector>
+
+using namespace EA::Bench;
+
+namespace
+{
+template <typename VectorType>
+void addElements(State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = VectorType();
+
+        for (int index = 0; index < state.size; ++index)
+            vec.push_back(index);
+
+        doNotOptimize(vec);
+    }
+}
+
+template <typename VectorType>
+void sumByIndex(State& state)
+{
+    auto vec = VectorType(std::size_t(state.size));
+    std::iota(vec.begin(), vec.end(), 0);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto sum = 0;
+
+        for (int index = 0; index < state.size; ++index)
+            sum += vec[index];
+
+        doNotOptimize(sum);
+    }
+}
+
+template <typename VectorType>
+void findLast(State& state)
+{
+    auto vec = VectorType(std::size_t(state.size));
+    std::iota(vec.begin(), vec.end(), 0);
+    auto last = state.size - 1;
+
+    while (state.keepRunning())
+    {
+        auto found = std::find(vec.begin(), vec.end(), last) != vec.end();
+        doNotOptimize(found);
+    }
+}
+
+//A buffer that's filled right after it's sized, like incoming audio
+template <typename VectorType>
+void resizeAndWrite(State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = VectorType();
+        vec.resize(std::size_t(state.size));
+
+        for (int index = 0; index < state.size; ++index)
+            vec[index] = float(index);
+
+        doNotOptimize(vec);
+    }
+}
+
+template <typename VectorType>
+void removeFront(State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = VectorType(std::size_t(state.size));
+
+        while (!vec.empty())
+            vec.erase(vec.begin());
+
+        doNotOptimize(vec);
+    }
+}
+} // namespace
+
+auto vectorAddEA = benchmark("Vector.add/EA", {16, 1024, 65536}) = [](State& state)
+{
+    addElements<EA::Vector<int>>(state);
+};
+
+auto vectorAddStd = benchmark("Vector.add/std", {16, 1024, 65536}) = [](State& state)
+{
+    addElements<std::vector<int>>(state);
+};
+
+auto vectorIndexEA = benchmark("Vector.index/EA", {1024, 65536}) = [](State& state)
+{
+    sumByIndex<EA::Vector<int>>(state);
+};
+
+auto vectorIndexStd = benchmark("Vector.index/std", {1024, 65536}) = [](State& state)
+{
+    sumByIndex<std::vector<int>>(state);
+};
+
+auto vectorContainsEA = benchmark("Vector.contains/EA", {16, 1024, 65536}) =
+    [](State& state)
+{
+    auto vec = EA::Vector<int>(state.size);
+    std::iota(vec.begin(), vec.end(), 0);
+    auto last = state.size - 1;
+
+    while (state.keepRunning())
+        doNotOptimize(vec.contains(last));
+};
+
+auto vectorContainsStd = benchmark("Vector.contains/std", {16, 1024, 65536}) =
+    [](State& state)
+{
+    findLast<std::vector<int>>(state);
+};
+
+auto vectorRemoveFrontEA = benchmark("Vector.removeAt_front/EA", {16, 1024}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::Vector<int>(state.size);
+
+        while (!vec.empty())
+            vec.removeAt(0);
+
+        doNotOptimize(vec);
+    }
+};
+
+auto vectorRemoveFrontStd = benchmark("Vector.removeAt_front/std", {16, 1024}) =
+    [](State& state)
+{
+    removeFront<std::vector<int>>(state);
+};
+
+auto vectorResizeWriteEA =
+    benchmark("Vector.resize_and_write/EA_default_init", {1024, 65536}) =
+        [](State& state)
+{
+    resizeAndWrite<EA::DefaultInitVector<float>>(state);
+};
+
+auto vectorResizeWriteStd = benchmark("Vector.resize_and_write/std", {1024, 65536}) =
+    [](State& state)
+{
+    resizeAndWrite<std::vector<float>>(state);
+};
+
+//Appends in batches of 16, reserving for each batch first
+auto vectorAddFromEA = benchmark("Vector.addFrom_batches/EA", {1024, 65536}) =
+    [](State& state)
+{
+    auto batch = EA::Vector<int>(16);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::Vector<int>();
+
+        for (int index = 0; index < state.size; index += batch.size())
+            vec.addFrom(batch);
+
+        doNotOptimize(vec);
+    }
+};
+
+auto vectorAddFromStd = benchmark("Vector.addFrom_batches/std", {1024, 65536}) =
+    [](State& state)
+{
+    auto batch = std::vector<int>(16);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<int>();
+
+        for (int index = 0; index < state.size; index += (int) batch.size())
+            vec.insert(vec.end(), batch.begin(), batch.end());
+
+        doNotOptimize(vec);
+    }
+};
+
+//Removes every other element by index
+auto vectorRemoveIndexesEA =
+    benchmark("Vector.removeIndexes_half/EA", {1024, 65536}) = [](State& state)
+{
+    auto indexes = EA::Vector<int>();
+
+    for (int index = 0; index < state.size; index += 2)
+        indexes.add(index);
+
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::Vector<int>(state.size);
+        vec.removeIndexes(indexes);
+        doNotOptimize(vec);
+    }
+};
+
+//One erase per index, from the back
+auto vectorRemoveIndexesStd =
+    benchmark("Vector.removeIndexes_half/std", {1024, 65536}) = [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<int>(std::size_t(state.size));
+
+        for (int index = (state.size - 1) / 2 * 2; index >= 0; index -= 2)
+            vec.erase(vec.begin() + index);
+
+        doNotOptimize(vec);
+    }
+};
+
+auto vectorUnorderedEraseIfEA =
+    benchmark("Vector.eraseIf_half/EA_unordered", {1024, 65536}) = [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = EA::Vector<int>(state.size);
+        std::iota(vec.begin(), vec.end(), 0);
+        vec.unorderedEraseIf([](int value) { return value % 2 == 0; });
+        doNotOptimize(vec);
+    }
+};
+
+auto vectorEraseIfStd = benchmark("Vector.eraseIf_half/std", {1024, 65536}) =
+    [](State& state)
+{
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto vec = std::vector<int>(std::size_t(state.size));
+        std::iota(vec.begin(), vec.end(), 0);
+        std::erase_if(vec, [](int value) { return value % 2 == 0; });
+        doNotOptimize(vec);
+    }
+};
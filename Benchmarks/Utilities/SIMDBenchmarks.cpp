@@ -0,0 +1,172 @@
+#include <Helpers/Benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <ea_data_structures/Utilities/SIMD.h>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace EA::Bench;
+
+//Mixing one block of samples into another, the inner loop of most audio
+//graphs. "std" is std::transform, "scalar" is the plain loop SIMD.h falls
+//back to when no vector instructions are available.
+namespace
+{
+struct Buffers
+{
+    explicit Buffers(int size)
+        : dest((size_t) size, 0.5f)
+        , source((size_t) size, 0.25f)
+    {
+    }
+
+    std::vector<float> dest;
+    std::vector<float> source;
+};
+} // namespace
+
+auto simdMixEA = benchmark("SIMD.mix/EA", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+    {
+        EA::SIMD::mix(buffers.dest.data(), buffers.source.data(), state.size);
+        doNotOptimize(buffers.dest.data());
+    }
+};
+
+auto simdMixScalar = benchmark("SIMD.mix/scalar", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+    {
+        EA::SIMD::Scalar::mix(
+            buffers.dest.data(), buffers.source.data(), state.size);
+        doNotOptimize(buffers.dest.data());
+    }
+};
+
+auto simdMixStd = benchmark("SIMD.mix/std", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+    auto& dest = buffers.dest;
+
+    while (state.keepRunning())
+    {
+        std::transform(dest.begin(),
+                       dest.end(),
+                       buffers.source.begin(),
+                       dest.begin(),
+                       std::plus<float>());
+        doNotOptimize(dest.data());
+    }
+};
+
+auto simdMixWithGainEA = benchmark("SIMD.mix_with_gain/EA", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+    {
+        EA::SIMD::mixWithGain(
+            buffers.dest.data(), buffers.source.data(), 0.5f, state.size);
+        doNotOptimize(buffers.dest.data());
+    }
+};
+
+auto simdMixWithGainStd = benchmark("SIMD.mix_with_gain/std", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto buffers = Buffers(state.size);
+    auto& dest = buffers.dest;
+
+    while (state.keepRunning())
+    {
+        std::transform(dest.begin(),
+                       dest.end(),
+                       buffers.source.begin(),
+                       dest.begin(),
+                       [](float a, float b) { return a + b * 0.5f; });
+        doNotOptimize(dest.data());
+    }
+};
+
+auto simdFillEA = benchmark("SIMD.fill/EA", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+    {
+        EA::SIMD::fill(buffers.dest.data(), 0.f, state.size);
+        doNotOptimize(buffers.dest.data());
+    }
+};
+
+auto simdFillStd = benchmark("SIMD.fill/std", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+    {
+        std::fill(buffers.dest.begin(), buffers.dest.end(), 0.f);
+        doNotOptimize(buffers.dest.data());
+    }
+};
+
+//Peak metering: the largest absolute sample of a block
+auto simdPeakEA = benchmark("SIMD.peak/EA", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+
+    while (state.keepRunning())
+        doNotOptimize(EA::SIMD::findPeak(buffers.source.data(), state.size));
+};
+
+auto simdPeakStd = benchmark("SIMD.peak/std", {64, 512, 4096}) = [](State& state)
+{
+    auto buffers = Buffers(state.size);
+    auto& source = buffers.source;
+    auto maxAbs = [](float peak, float sample)
+    { return std::max(peak, std::abs(sample)); };
+
+    while (state.keepRunning())
+        doNotOptimize(std::accumulate(source.begin(), source.end(), 0.f, maxAbs));
+};
+
+//Writing a stereo block into an interleaved output buffer
+auto simdInterleaveEA = benchmark("SIMD.interleave_stereo/EA", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto buffers = Buffers(state.size);
+    auto interleaved = std::vector<float>((size_t) state.size * 2);
+    const float* channels[] = {buffers.dest.data(), buffers.source.data()};
+
+    while (state.keepRunning())
+    {
+        EA::SIMD::interleave(interleaved.data(), channels, 2, state.size);
+        doNotOptimize(interleaved.data());
+    }
+};
+
+auto simdInterleaveStd = benchmark("SIMD.interleave_stereo/std", {64, 512, 4096}) =
+    [](State& state)
+{
+    auto buffers = Buffers(state.size);
+    auto interleaved = std::vector<float>((size_t) state.size * 2);
+
+    while (state.keepRunning())
+    {
+        for (size_t index = 0; index < (size_t) state.size; ++index)
+        {
+            interleaved[index * 2] = buffers.dest[index];
+            interleaved[index * 2 + 1] = buffers.source[index];
+        }
+
+        doNotOptimize(interleaved.data());
+    }
+};
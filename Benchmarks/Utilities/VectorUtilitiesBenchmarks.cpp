@@ -0,0 +1,88 @@
+#include <Helpers/Benchmark.h>
+#include <algorithm>
+#include <ea_data_structures/Utilities/VectorUtilities.h>
+#include <vector>
+
+using namespace EA::Bench;
+
+//The parallel Vectors algorithms against the serial std ones. Both sort a
+//fresh copy of the same shuffled data every iteration, so the copy is in
+//both. On a machine with one core the pool has no workers and EA_par runs
+//serially.
+namespace
+{
+std::vector<int> getShuffledInts(int size)
+{
+    auto values = std::vector<int>((size_t) size);
+    auto seed = 12345u;
+
+    for (auto& value: values)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        value = (int) (seed >> 8);
+    }
+
+    return values;
+}
+} // namespace
+
+auto vectorsSortPar =
+    benchmark("Vectors.sort/EA_par", {100000, 4000000}) = [](State& state)
+{
+    auto source = getShuffledInts(state.size);
+    auto values = source;
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        std::copy(source.begin(), source.end(), values.begin());
+        EA::Vectors::sort(EA::Execution::par, values);
+        doNotOptimize(values.data());
+    }
+};
+
+auto vectorsSortStd = benchmark("Vectors.sort/std", {100000, 4000000}) =
+    [](State& state)
+{
+    auto source = getShuffledInts(state.size);
+    auto values = source;
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        std::copy(source.begin(), source.end(), values.begin());
+        std::sort(values.begin(), values.end());
+        doNotOptimize(values.data());
+    }
+};
+
+auto vectorsFilterPar =
+    benchmark("Vectors.filter/EA_par", {100000, 4000000}) = [](State& state)
+{
+    auto values = getShuffledInts(state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto isOdd = [](int x) { return (x & 1) != 0; };
+        auto kept = EA::Vectors::filter(EA::Execution::par, values, isOdd);
+        doNotOptimize(kept.data());
+    }
+};
+
+auto vectorsFilterStd = benchmark("Vectors.filter/std", {100000, 4000000}) =
+    [](State& state)
+{
+    auto values = getShuffledInts(state.size);
+    state.setItemsPerIteration(state.size);
+
+    while (state.keepRunning())
+    {
+        auto kept = std::vector<int>();
+        std::copy_if(values.begin(),
+                     values.end(),
+                     std::back_inserter(kept),
+                     [](int x) { return (x & 1) != 0; });
+        doNotOptimize(kept.data());
+    }
+};
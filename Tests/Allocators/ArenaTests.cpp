@@ -0,0 +1,105 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Allocators/Arena.h>
+#include <ea_data_structures/Allocators/PMR.h>
+#include <cstdint>
+#include <string>
+
+using namespace nano;
+
+namespace
+{
+void allocateBlocks(EA::Allocators::Arena& arena, int numBlocks, size_t bytes)
+{
+    for (int index = 0; index < numBlocks; ++index)
+        check(arena.allocate(bytes) != nullptr);
+}
+} // namespace
+
+auto arenaBumps = test("Arena.allocations_are_contiguous_and_aligned") = []
+{
+    auto arena = EA::Allocators::Arena(1024);
+    auto* first = static_cast<char*>(arena.allocate(10, 1));
+    auto* second = static_cast<char*>(arena.allocate(10, 1));
+    auto* aligned = arena.allocate(8, 64);
+
+    check(second == first + 10);
+    check((std::uintptr_t) aligned % 64 == 0);
+};
+
+auto arenaRewind = test("Arena.rewindTo_reuses_memory") = []
+{
+    auto arena = EA::Allocators::Arena(1024);
+    allocateBlocks(arena, 1, 100);
+
+    auto marker = arena.mark();
+    auto* scratch = arena.allocate(200);
+    allocateBlocks(arena, 1, 300);
+    arena.rewindTo(marker);
+
+    check(arena.allocate(200) == scratch);
+};
+
+auto arenaChains = test("Arena.chains_bigger_chunks_when_full") = []
+{
+    auto arena = EA::Allocators::Arena(256);
+
+    allocateBlocks(arena, 10, 100);
+
+    check(arena.getNumChunks() > 1);
+    check(arena.getCapacity() >= 1000);
+
+    auto* big = static_cast<char*>(arena.allocate(5000));
+    big[4999] = 1;
+    check(arena.getCapacity() >= 6000);
+};
+
+auto arenaKeepsChunks = test("Arena.reset_keeps_chunks_for_reuse") = []
+{
+    auto arena = EA::Allocators::Arena(256);
+
+    allocateBlocks(arena, 10, 100);
+
+    auto numChunks = arena.getNumChunks();
+    arena.reset();
+    check(arena.getBytesUsed() == 0);
+
+    allocateBlocks(arena, 10, 100);
+
+    check(arena.getNumChunks() == numChunks);
+};
+
+auto arenaScope = test("ArenaScope.rewinds_on_exit") = []
+{
+    auto arena = EA::Allocators::Arena(1024);
+    allocateBlocks(arena, 1, 16);
+    auto used = arena.getBytesUsed();
+
+    {
+        auto scope = EA::Allocators::ArenaScope(arena);
+        allocateBlocks(arena, 1, 500);
+        check(arena.getBytesUsed() > used);
+    }
+
+    check(arena.getBytesUsed() == used);
+};
+
+auto arenaWithPMR = test("Arena.works_with_PMR_object_and_makeShared") = []
+{
+    auto arena = EA::Allocators::Arena(128);
+
+    {
+        auto vec = EA::PMR::Vector<int>(arena);
+
+        for (int index = 0; index < 1000; ++index)
+            vec->push_back(index);
+
+        check(vec->back() == 999);
+
+        auto shared = EA::PMR::makeShared<std::string>(arena, "scratch");
+        check(*shared == "scratch");
+    }
+
+    check(arena.getBytesUsed() > 4000);
+    arena.reset();
+    check(arena.getBytesUsed() == 0);
+};
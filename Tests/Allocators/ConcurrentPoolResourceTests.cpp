@@ -0,0 +1,184 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Allocators/ConcurrentPoolResource.h>
+#include <ea_data_structures/Allocators/PMR.h>
+#include <cstring>
+#include <future>
+#include <memory_resource>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+namespace
+{
+//Counts the bytes the upstream resource still has out
+struct CountingResource final : std::pmr::memory_resource
+{
+    long long bytesInUse = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        bytesInUse += (long long) bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* data, size_t bytes, size_t alignment) override
+    {
+        bytesInUse -= (long long) bytes;
+        std::pmr::new_delete_resource()->deallocate(data, bytes, alignment);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return &other == this;
+    }
+};
+} // namespace
+
+auto concurrentPoolReuse = test("ConcurrentPoolResource.reuses_freed_blocks") = []
+{
+    auto resource = EA::Allocators::ConcurrentPoolResource();
+    auto* first = resource.allocate(40);
+    resource.deallocate(first, 40);
+
+    check(resource.allocate(64) == first);
+};
+
+auto concurrentPoolDistinct =
+    test("ConcurrentPoolResource.hands_out_distinct_blocks") = []
+{
+    auto options = EA::Allocators::ConcurrentPoolOptions();
+    options.magazineSize = 4;
+
+    auto resource = EA::Allocators::ConcurrentPoolResource(options);
+    auto blocks = std::set<void*>();
+
+    for (int index = 0; index < 100; ++index)
+        blocks.insert(resource.allocate(32));
+
+    check(blocks.size() == 100);
+
+    for (auto* block: blocks)
+        resource.deallocate(block, 32);
+};
+
+auto concurrentPoolOversize =
+    test("ConcurrentPoolResource.oversized_requests_go_upstream") = []
+{
+    auto resource = EA::Allocators::ConcurrentPoolResource();
+    auto* big = static_cast<char*>(resource.allocate(100000));
+    big[99999] = 1;
+    resource.deallocate(big, 100000);
+    check(true);
+};
+
+auto concurrentPoolThreads =
+    test("ConcurrentPoolResource.many_threads_allocate_and_free") = []
+{
+    constexpr int numThreads = 4;
+    constexpr int numBlocks = 2000;
+
+    auto options = EA::Allocators::ConcurrentPoolOptions();
+    options.magazineSize = 8;
+
+    auto resource = EA::Allocators::ConcurrentPoolResource(options);
+    auto threads = std::vector<std::thread>();
+    auto results = std::vector<bool>(numThreads);
+
+    //Every thread fills its blocks with its own pattern and checks nobody else
+    //wrote to them before freeing
+    for (int thread = 0; thread < numThreads; ++thread)
+    {
+        threads.emplace_back(
+            [&, thread]
+            {
+                auto blocks = std::vector<unsigned char*>();
+                auto ok = true;
+
+                for (int round = 0; round < 3; ++round)
+                {
+                    for (int index = 0; index < numBlocks; ++index)
+                    {
+                        auto* block = (unsigned char*) resource.allocate(48);
+                        std::memset(block, thread, 48);
+                        blocks.push_back(block);
+                    }
+
+                    for (auto* block: blocks)
+                    {
+                        ok = ok && block[0] == thread && block[47] == thread;
+                        resource.deallocate(block, 48);
+                    }
+
+                    blocks.clear();
+                }
+
+                results[(size_t) thread] = ok;
+            });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    for (auto result: results)
+        check(result);
+};
+
+auto concurrentPoolCrossThreadFree =
+    test("ConcurrentPoolResource.blocks_can_be_freed_on_another_thread") = []
+{
+    auto resource = EA::Allocators::ConcurrentPoolResource();
+    auto blocks = std::vector<void*>();
+
+    for (int index = 0; index < 100; ++index)
+        blocks.push_back(resource.allocate(16));
+
+    auto t = std::thread(
+        [&]
+        {
+            for (auto* block: blocks)
+                resource.deallocate(block, 16);
+        });
+    t.join();
+
+    auto vec = EA::PMR::Vector<int>(resource);
+    vec->assign(1000, 7);
+    check(vec->back() == 7);
+};
+
+auto concurrentPoolReleasesOnDestruction =
+    test("ConcurrentPoolResource.destructor_frees_slabs_cached_by_live_threads") = []
+{
+    auto upstream = CountingResource();
+    auto resource = std::make_unique<EA::Allocators::ConcurrentPoolResource>(
+        EA::Allocators::ConcurrentPoolOptions(), &upstream);
+
+    auto cached = std::promise<void>();
+    auto destroyed = std::promise<void>();
+    auto destroyedFuture = destroyed.get_future();
+
+    //Keeps its cached blocks, and outlives the resource
+    auto worker = std::thread(
+        [&]
+        {
+            resource->deallocate(resource->allocate(32), 32);
+            cached.set_value();
+            destroyedFuture.wait();
+
+            auto other = EA::Allocators::ConcurrentPoolResource();
+            other.deallocate(other.allocate(32), 32);
+        });
+
+    cached.get_future().wait();
+    resource->deallocate(resource->allocate(64), 64);
+    check(upstream.bytesInUse > 0);
+
+    resource.reset();
+    check(upstream.bytesInUse == 0);
+
+    destroyed.set_value();
+    worker.join();
+    check(upstream.bytesInUse == 0);
+};
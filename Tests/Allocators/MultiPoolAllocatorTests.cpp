@@ -0,0 +1,157 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Allocators/MultiPoolAllocator.h>
+#include <ea_data_structures/Allocators/PMR.h>
+#include <cstdint>
+#include <memory_resource>
+#include <set>
+
+using namespace nano;
+
+auto memoryPoolReusesBlocks = test("MemoryPool.deallocated_block_is_reused") = []
+{
+    auto pool = EA::Allocators::MemoryPool(64, 4);
+    auto* first = pool.allocate(64);
+    pool.deallocate(first, 64);
+
+    check(pool.allocate(32) == first);
+};
+
+auto memoryPoolDistinctBlocks =
+    test("MemoryPool.blocks_are_distinct_and_aligned") = []
+{
+    auto pool = EA::Allocators::MemoryPool(24, 8);
+    auto blocks = std::set<void*>();
+
+    for (int index = 0; index < 8; ++index)
+    {
+        auto* block = pool.allocate(24);
+        check((std::uintptr_t) block % alignof(std::max_align_t) == 0);
+        blocks.insert(block);
+    }
+
+    check(blocks.size() == 8);
+    check(pool.getCapacity() == 8);
+};
+
+auto memoryPoolGrows = test("MemoryPool.grows_by_a_slab_when_exhausted") = []
+{
+    auto pool = EA::Allocators::MemoryPool(16, 4);
+
+    for (int index = 0; index < 5; ++index)
+        pool.allocate(16);
+
+    check(pool.getCapacity() == 8);
+};
+
+auto memoryPoolOversize = test("MemoryPool.oversized_requests_bypass_the_pool") = []
+{
+    auto pool = EA::Allocators::MemoryPool(16, 4);
+    auto* big = static_cast<char*>(pool.allocate(1000));
+    big[999] = 1;
+    pool.deallocate(big, 1000);
+
+    check(pool.getCapacity() == 4);
+};
+
+auto memoryPoolResourceWorksWithPMR =
+    test("MemoryPoolResource.backs_pmr_vector") = []
+{
+    auto resource = EA::Allocators::MemoryPoolResource(256, 16);
+    auto vec = EA::PMR::Vector<int>(resource);
+
+    for (int index = 0; index < 1000; ++index)
+        vec->push_back(index);
+
+    check(vec->size() == 1000);
+    check(vec->back() == 999);
+};
+
+namespace
+{
+//Counts what reaches the upstream resource
+struct CountingResource final : std::pmr::memory_resource
+{
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* data, size_t bytes, size_t alignment) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(data, bytes, alignment);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return &other == this;
+    }
+};
+} // namespace
+
+auto multiPoolSizeClasses =
+    test("MultiPoolResource.rounds_to_power_of_two_classes") = []
+{
+    auto options = EA::Allocators::MultiPoolResource::Options();
+    options.minBlockSize = 16;
+    options.maxBlockSize = 256;
+
+    auto resource = EA::Allocators::MultiPoolResource(options);
+    auto& stats = resource.getStatistics();
+
+    check(resource.getNumSizeClasses() == 5);
+    check(stats[0].blockSize == 16 && stats[4].blockSize == 256);
+
+    auto* small = resource.allocate(10);
+    auto* medium = resource.allocate(33);
+
+    check(stats[0].misses == 1);
+    check(stats[2].misses == 1);
+
+    resource.deallocate(small, 10);
+    resource.deallocate(medium, 33);
+
+    auto* again = resource.allocate(16);
+    check(again == small);
+    check(stats[0].hits == 1);
+    resource.deallocate(again, 16);
+};
+
+auto multiPoolOversize =
+    test("MultiPoolResource.forwards_oversized_requests_upstream") = []
+{
+    auto upstream = CountingResource();
+
+    {
+        auto options = EA::Allocators::MultiPoolResource::Options();
+        options.maxBlockSize = 64;
+
+        auto resource = EA::Allocators::MultiPoolResource(options, &upstream);
+        auto* big = resource.allocate(1000);
+        check(resource.getNumUpstreamAllocations() == 1);
+        resource.deallocate(big, 1000);
+
+        auto* pooled = resource.allocate(64);
+        resource.deallocate(pooled, 64);
+        check(upstream.allocations == 2);
+    }
+
+    check(upstream.deallocations == 2);
+};
+
+auto multiPoolWithPMR = test("MultiPoolResource.backs_pmr_containers") = []
+{
+    auto resource = EA::Allocators::MultiPoolResource();
+    auto vec = EA::PMR::Vector<int>(resource);
+
+    for (int index = 0; index < 5000; ++index)
+        vec->push_back(index);
+
+    check(vec->back() == 4999);
+    check(resource.getNumUpstreamAllocations() > 0);
+};
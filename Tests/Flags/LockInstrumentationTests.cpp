@@ -0,0 +1,89 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Flags/Locks.h>
+#include <ea_data_structures/Flags/RecursiveSpinLock.h>
+#include <string>
+#include <thread>
+
+using namespace nano;
+
+#if EA_LOCK_INSTRUMENTATION
+
+auto lockStatsUncontended = test("LockInstrumentation.counts_acquisitions") = []
+{
+    auto lock = EA::Locks::PrimitiveSpinLock();
+
+    for (int index = 0; index < 3; ++index)
+    {
+        auto guard = EA::Locks::ScopedSpinLock(lock);
+    }
+
+    auto stats = lock.getLockStats();
+    check(stats.acquisitions == 3);
+    check(stats.contendedAcquisitions == 0);
+    check(stats.spins == 0);
+};
+
+auto lockStatsContended = test("LockInstrumentation.counts_contention") = []
+{
+    auto lock = EA::Locks::RecursiveSpinLock();
+    lock.setLockName("contended");
+    lock.lock();
+
+    auto waiter = std::thread(
+        [&]
+        {
+            lock.lock();
+            lock.unlock();
+        });
+
+    for (int index = 0; index < 20; ++index)
+        std::this_thread::yield();
+
+    lock.unlock();
+    waiter.join();
+
+    auto stats = lock.getLockStats();
+    check(stats.name == "contended");
+    check(stats.acquisitions == 2);
+    check(stats.contendedAcquisitions <= 1);
+    check(stats.spins >= stats.contendedAcquisitions);
+};
+
+auto lockStatsRegistry = test("LockInstrumentation.registry_keeps_destroyed") = []
+{
+    auto& registry = EA::Locks::LockRegistry::get();
+
+    {
+        auto lock = EA::Locks::PrimitiveSpinLock();
+        lock.setLockName("short lived");
+        lock.lock();
+        lock.unlock();
+    }
+
+    auto found = false;
+
+    for (auto& stats: registry.getStats())
+    {
+        if (stats.name == "short lived")
+            found = stats.acquisitions >= 1;
+    }
+
+    check(found);
+    check(registry.getReport().find("short lived") != std::string::npos);
+};
+
+#else
+
+auto lockStatsDisabled = test("LockInstrumentation.costs_nothing_when_off") = []
+{
+    check(!EA::Locks::isLockInstrumentationEnabled());
+    check(sizeof(EA::Locks::PrimitiveSpinLock) == sizeof(EA::Locks::AtomicFlag));
+
+    auto lock = EA::Locks::PrimitiveSpinLock();
+    lock.setLockName("ignored");
+    lock.lock();
+    check(lock.isLocked());
+    lock.unlock();
+};
+
+#endif
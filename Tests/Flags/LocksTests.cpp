@@ -1,8 +1,56 @@
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Flags/Locks.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace nano;
 
+namespace
+{
+//Increments a plain int from several threads under the lock. Any lost
+//increment means two threads were inside at once.
+template <typename Lock>
+int countUnderContention(int numThreads, int numIncrements)
+{
+    auto lock = Lock();
+    auto counter = 0;
+    auto threads = std::vector<std::thread>();
+
+    for (int thread = 0; thread < numThreads; ++thread)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                for (int index = 0; index < numIncrements; ++index)
+                {
+                    auto guard = EA::Locks::ScopedSpinLock(lock);
+                    ++counter;
+                }
+            });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    return counter;
+}
+
+template <typename Lock>
+void checkTryLock()
+{
+    auto lock = Lock();
+    check(!lock.isLocked());
+    check(lock.tryLock());
+    check(lock.isLocked());
+    check(!lock.tryLock());
+    lock.unlock();
+    check(!lock.isLocked());
+    check(lock.tryLock());
+    lock.unlock();
+}
+} // namespace
+
 auto spinLockUnlocked = test("PrimitiveSpinLock.starts_unlocked") = []
 {
     auto lock = EA::Locks::PrimitiveSpinLock();
@@ -38,3 +86,122 @@ auto scopedSpinLockRAII = test("ScopedSpinLock.RAII_releases_on_scope_exit") = [
     }
     check(!lock.isLocked());
 };
+
+auto ticketLockTryLock = test("TicketLock.tryLock") = []
+{
+    checkTryLock<EA::Locks::TicketLock>();
+};
+
+auto ticketLockExclusive = test("TicketLock.excludes_other_threads") = []
+{
+    check(countUnderContention<EA::Locks::TicketLock>(4, 2000) == 8000);
+};
+
+auto mcsLockTryLock = test("MCSLock.tryLock") = []
+{
+    checkTryLock<EA::Locks::MCSLock>();
+};
+
+auto mcsLockExclusive = test("MCSLock.excludes_other_threads") = []
+{
+    check(countUnderContention<EA::Locks::MCSLock>(4, 2000) == 8000);
+};
+
+auto mcsLockNested = test("MCSLock.thread_can_hold_several") = []
+{
+    auto first = EA::Locks::MCSLock();
+    auto second = EA::Locks::MCSLock();
+
+    first.lock();
+    second.lock();
+    check(first.isLocked());
+    check(second.isLocked());
+
+    first.unlock();
+    check(!first.isLocked());
+    second.unlock();
+    check(!second.isLocked());
+};
+
+auto spinThenBlockTryLock = test("SpinThenBlockLock.tryLock") = []
+{
+    checkTryLock<EA::Locks::SpinThenBlockLock>();
+};
+
+auto spinThenBlockExclusive =
+    test("SpinThenBlockLock.excludes_other_threads") = []
+{
+    auto counter = countUnderContention<EA::Locks::SpinThenBlockLock>(4, 2000);
+    check(counter == 8000);
+};
+
+auto primitiveSpinLockExclusive =
+    test("PrimitiveSpinLock.excludes_other_threads") = []
+{
+    auto counter = countUnderContention<EA::Locks::PrimitiveSpinLock>(4, 2000);
+    check(counter == 8000);
+};
+
+auto readWriteSharedReaders = test("ReadWriteSpinLock.readers_share") = []
+{
+    auto lock = EA::Locks::ReadWriteSpinLock();
+    lock.lockShared();
+    check(lock.tryLockShared());
+    check(lock.getNumReaders() == 2);
+    check(!lock.tryLock());
+
+    lock.unlockShared();
+    lock.unlockShared();
+    check(!lock.isLocked());
+
+    check(lock.tryLock());
+    check(!lock.tryLockShared());
+    lock.unlock();
+    check(!lock.isLocked());
+};
+
+auto readWriteWriterPreference =
+    test("ReadWriteSpinLock.waiting_writer_blocks_new_readers") = []
+{
+    auto lock = EA::Locks::ReadWriteSpinLock();
+    auto written = std::atomic<bool>(false);
+
+    lock.lockShared();
+
+    auto writer = std::thread(
+        [&]
+        {
+            auto guard = EA::Locks::ScopedSpinLock(lock);
+            written = true;
+        });
+
+    //Wait until the writer is queued: from then on, readers are refused
+    while (lock.tryLockShared())
+    {
+        lock.unlockShared();
+        std::this_thread::yield();
+    }
+
+    check(!written);
+    lock.unlockShared();
+    writer.join();
+
+    check(written);
+    check(!lock.isLocked());
+};
+
+auto readWriteExclusive = test("ReadWriteSpinLock.excludes_other_threads") = []
+{
+    auto counter = countUnderContention<EA::Locks::ReadWriteSpinLock>(4, 2000);
+    check(counter == 8000);
+};
+
+auto readWriteScopedShared = test("ScopedSharedSpinLock.RAII") = []
+{
+    auto lock = EA::Locks::ReadWriteSpinLock();
+    {
+        auto guard = EA::Locks::ScopedSharedSpinLock(lock);
+        check(lock.getNumReaders() == 1);
+    }
+    check(!lock.isLocked());
+};
@@ -1,6 +1,7 @@
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Flags/RecursiveSpinLock.h>
 #include <thread>
+#include <vector>
 
 using namespace nano;
 
@@ -35,3 +36,32 @@ auto recursiveSpinLockAnotherThread =
     t.join();
     check(acquired);
 };
+
+auto recursiveSpinLockExclusive =
+    test("RecursiveSpinLock.excludes_other_threads") = []
+{
+    auto lock = EA::Locks::RecursiveSpinLock();
+    auto counter = 0;
+    auto threads = std::vector<std::thread>();
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                for (int index = 0; index < 2000; ++index)
+                {
+                    lock.lock();
+                    lock.lock();
+                    ++counter;
+                    lock.unlock();
+                    lock.unlock();
+                }
+            });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    check(counter == 8000);
+};
@@ -0,0 +1,79 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Flags/SeqLock.h>
+#include <atomic>
+#include <thread>
+
+using namespace nano;
+
+namespace
+{
+struct Params
+{
+    float gain = 1.f;
+    int mode = 0;
+    double position = 0.0;
+    char name[5] {};
+};
+} // namespace
+
+auto seqLockLoadStore = test("SeqLock.store_then_load") = []
+{
+    auto shared = EA::Locks::SeqLock<Params>();
+    check(shared.load().gain == 1.f);
+
+    shared.store({0.5f, 3, 2.5, "abc"});
+
+    auto params = shared.load();
+    check(params.gain == 0.5f);
+    check(params.mode == 3);
+    check(params.position == 2.5);
+    check(params.name[2] == 'c');
+};
+
+auto seqLockTryLoad = test("SeqLock.tryLoad_when_idle") = []
+{
+    auto shared = EA::Locks::SeqLock<int>(7);
+    auto value = 0;
+
+    check(shared.tryLoad(value));
+    check(value == 7);
+};
+
+auto seqLockModify = test("SeqLock.modify") = []
+{
+    auto shared = EA::Locks::SeqLock<Params>();
+    shared.modify([](Params& params) { params.mode = 4; });
+
+    check(shared.load().mode == 4);
+    check(shared.load().gain == 1.f);
+};
+
+auto seqLockConsistent = test("SeqLock.reader_never_sees_a_partial_store") = []
+{
+    auto shared = EA::Locks::SeqLock<Params>();
+    auto done = std::atomic<bool>(false);
+    auto torn = 0;
+
+    auto reader = std::thread(
+        [&]
+        {
+            while (!done)
+            {
+                auto params = shared.load();
+
+                if ((double) params.mode != params.position)
+                    ++torn;
+
+                std::this_thread::yield();
+            }
+        });
+
+    for (int index = 0; index < 2000; ++index)
+        shared.store({1.f, index, (double) index, {}});
+
+    done = true;
+    reader.join();
+
+    check(torn == 0);
+    check(shared.load().mode == 1999);
+};
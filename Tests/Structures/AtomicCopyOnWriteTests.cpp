@@ -0,0 +1,163 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/AtomicCopyOnWrite.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+namespace
+{
+struct Counted
+{
+    explicit Counted(int valueToUse, std::atomic<int>& aliveToUse)
+        : value(valueToUse)
+        , alive(aliveToUse)
+    {
+        ++alive;
+    }
+
+    Counted(const Counted& other)
+        : value(other.value)
+        , alive(other.alive)
+    {
+        ++alive;
+    }
+
+    ~Counted() { --alive; }
+
+    int value;
+    std::atomic<int>& alive;
+};
+} // namespace
+
+auto atomicCowLoadStore = test("AtomicCopyOnWrite.store_replaces_value") = []
+{
+    auto shared = EA::AtomicCopyOnWrite<std::string>("first");
+    check(*shared.load() == "first");
+
+    shared.store("second");
+    check(*shared.load() == "second");
+    check(shared.load()->size() == 6);
+};
+
+auto atomicCowUpdate = test("AtomicCopyOnWrite.update_changes_a_copy") = []
+{
+    auto shared = EA::AtomicCopyOnWrite<std::vector<int>>(std::vector<int> {1});
+    auto before = shared.load();
+
+    shared.update([](std::vector<int>& values) { values.push_back(2); });
+
+    check(*before == std::vector<int> {1});
+    check(*shared.load() == std::vector<int> {1, 2});
+};
+
+auto atomicCowGuardKeepsAlive =
+    test("AtomicCopyOnWrite.guard_delays_deleting_its_value") = []
+{
+    auto alive = std::atomic<int>(0);
+
+    {
+        auto shared = EA::AtomicCopyOnWrite<Counted>(1, alive);
+
+        {
+            auto guard = shared.load();
+            shared.store(Counted(2, alive));
+
+            check(guard->value == 1);
+            check(shared.getNumRetired() == 1);
+            check(alive == 2);
+        }
+
+        shared.reclaim();
+        check(shared.getNumRetired() == 0);
+        check(alive == 1);
+        check(shared.load()->value == 2);
+    }
+
+    check(alive == 0);
+};
+
+auto atomicCowNestedGuards =
+    test("AtomicCopyOnWrite.nested_guards_keep_the_oldest_value") = []
+{
+    auto shared = EA::AtomicCopyOnWrite<int>(1);
+    auto outer = shared.load();
+
+    {
+        auto inner = shared.load();
+        shared.store(2);
+    }
+
+    shared.reclaim();
+    check(*outer == 1);
+    check(shared.getNumRetired() == 1);
+};
+
+auto atomicCowConcurrent =
+    test("AtomicCopyOnWrite.concurrent_readers_and_writers") = []
+{
+    constexpr int numWriters = 2;
+    constexpr int numUpdates = 300;
+
+    auto alive = std::atomic<int>(0);
+    auto done = std::atomic<bool>(false);
+    auto badReads = std::atomic<int>(0);
+
+    {
+        auto shared = EA::AtomicCopyOnWrite<Counted>(0, alive);
+        auto threads = std::vector<std::thread>();
+
+        for (int reader = 0; reader < 2; ++reader)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    auto last = 0;
+
+                    while (!done)
+                    {
+                        auto guard = shared.load();
+
+                        if (guard->value < last)
+                            ++badReads;
+
+                        last = guard->value;
+                        std::this_thread::yield();
+                    }
+                });
+        }
+
+        auto writers = std::vector<std::thread>();
+
+        for (int writer = 0; writer < numWriters; ++writer)
+        {
+            writers.emplace_back(
+                [&]
+                {
+                    for (int index = 0; index < numUpdates; ++index)
+                    {
+                        shared.update([](Counted& item) { ++item.value; });
+                        std::this_thread::yield();
+                    }
+                });
+        }
+
+        for (auto& writer: writers)
+            writer.join();
+
+        done = true;
+
+        for (auto& thread: threads)
+            thread.join();
+
+        check(badReads == 0);
+        check(shared.load()->value == numWriters * numUpdates);
+
+        shared.reclaim();
+        check(alive == 1);
+    }
+
+    check(alive == 0);
+};
@@ -1,5 +1,6 @@
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Structures/BufferView.h>
+#include <cmath>
 
 using namespace nano;
 
@@ -50,3 +51,97 @@ auto twoDimBufferView = test("TwoDimensionalBufferView.iterates_channels") = []
 
     check(channelSum == 1 + 2 + 3 + 4 + 5 + 6);
 };
+
+auto bufferViewAdd = test("BufferView.add_copy_and_gain") = []
+{
+    float data[] = {1.f, 2.f, 3.f, 4.f, 5.f};
+    float other[] = {1.f, 1.f, 1.f, 1.f, 1.f};
+    auto view = EA::BufferView<float>(data, 5);
+    auto source = EA::BufferView<float>(other, 5);
+
+    view.add(source);
+    check(data[0] == 2.f && data[4] == 6.f);
+
+    view.add(source, 2.f);
+    check(data[0] == 4.f && data[4] == 8.f);
+
+    view.multiply(source);
+    view.applyGain(0.5f);
+    check(data[0] == 2.f && data[4] == 4.f);
+
+    view.copyFrom(source);
+    check(data[2] == 1.f);
+
+    view.clear();
+    check(data[4] == 0.f);
+};
+
+auto bufferViewSizes = test("BufferView.only_touches_the_common_samples") = []
+{
+    float data[] = {1.f, 1.f, 1.f};
+    float other[] = {2.f, 2.f};
+    auto view = EA::BufferView<float>(data, 3);
+
+    view.add(EA::BufferView<const float>(other, 2));
+    check(data[0] == 3.f && data[1] == 3.f && data[2] == 1.f);
+};
+
+auto bufferViewMeasure = test("BufferView.peak_min_max_and_rms") = []
+{
+    const float data[] = {0.5f, -2.f, 1.f, -0.5f, 0.f, 1.5f, -1.f, 0.5f, 2.f};
+    auto view = EA::BufferView<const float>(data, 9);
+
+    check(view.getPeak() == 2.f);
+    check(view.findMinMax().min == -2.f);
+    check(view.findMinMax().max == 2.f);
+
+    auto squares = 0.25f + 4.f + 1.f + 0.25f + 2.25f + 1.f + 0.25f + 4.f;
+    check(std::abs(view.getRMS() - std::sqrt(squares / 9.f)) < 1e-6f);
+};
+
+auto bufferViewRamp = test("BufferView.gain_ramp") = []
+{
+    float data[] = {1.f, 1.f, 1.f, 1.f};
+    auto view = EA::BufferView<float>(data, 4);
+
+    view.applyGainRamp(0.f, 1.f);
+    check(data[0] == 0.f && data[1] == 0.25f && data[2] == 0.5f && data[3] == 0.75f);
+};
+
+auto twoDimOperations = test("TwoDimensionalBufferView.channel_operations") = []
+{
+    float left[] = {1.f, -3.f, 1.f};
+    float right[] = {2.f, 2.f, 2.f};
+    float* channels[] = {left, right};
+    auto view = EA::getViewFor<float>(channels, 2, 3);
+
+    check(view[1][2] == 2.f);
+    check(view.getPeak() == 3.f);
+
+    view.applyGain(2.f);
+    check(left[1] == -6.f && right[0] == 4.f);
+
+    view.add(view, -1.f);
+    check(left[0] == 0.f && right[2] == 0.f);
+
+    right[0] = 1.f;
+    view.clear();
+    check(view.getPeak() == 0.f);
+};
+
+auto twoDimInterleave = test("TwoDimensionalBufferView.interleave_round_trip") = []
+{
+    float left[] = {1.f, 2.f, 3.f, 4.f, 5.f};
+    float right[] = {-1.f, -2.f, -3.f, -4.f, -5.f};
+    float* channels[] = {left, right};
+    auto view = EA::getViewFor<float>(channels, 2, 5);
+
+    float frames[10] {};
+    view.interleaveTo({frames, 10});
+    check(frames[0] == 1.f && frames[1] == -1.f && frames[8] == 5.f);
+    check(frames[9] == -5.f);
+
+    view.clear();
+    view.deinterleaveFrom(EA::BufferView<const float>(frames, 10));
+    check(left[4] == 5.f && right[3] == -4.f);
+};
@@ -49,3 +49,79 @@ auto circularInitialValue = test("CircularBuffer.constructor_initial_value") = [
     check(buffer[1] == 7);
     check(buffer[2] == 7);
 };
+
+using PowerOfTwoBuffer = EA::CircularBuffer<int, EA::CircularIndexing::PowerOfTwo>;
+
+auto circularPowerOfTwoSize = test("CircularBuffer.power_of_two_rounds_size_up") = []
+{
+    check(PowerOfTwoBuffer(5).size() == 8);
+    check(PowerOfTwoBuffer(8).size() == 8);
+    check(PowerOfTwoBuffer(1).size() == 1);
+};
+
+auto circularPowerOfTwoWraps =
+    test("CircularBuffer.power_of_two_wraps_with_mask") = []
+{
+    auto buffer = PowerOfTwoBuffer(4, 0);
+    auto modulo = EA::CircularBuffer<int>(4, 0);
+
+    for (int index = 0; index < 4; ++index)
+    {
+        buffer[index] = (index + 1) * 10;
+        modulo[index] = (index + 1) * 10;
+    }
+
+    for (int index = -9; index < 9; ++index)
+        check(buffer[index] == modulo[index]);
+
+    check(buffer[(size_t) 6] == 30);
+};
+
+auto circularSegments = test("CircularBuffer.segments_split_at_the_end") = []
+{
+    auto buffer = EA::CircularBuffer<int>(6);
+
+    auto inside = buffer.getSegments(1, 3);
+    check(inside.first.size() == 3);
+    check(inside.second.size() == 0);
+    check(inside.first.begin() == &buffer[1]);
+
+    auto wrapped = buffer.getSegments(-2, 5);
+    check(wrapped.first.begin() == &buffer[4]);
+    check(wrapped.first.size() == 2);
+    check(wrapped.second.begin() == &buffer[0]);
+    check(wrapped.second.size() == 3);
+
+    check(buffer.getSegments(3, 100).size() == 6);
+    check(buffer.getSegments(3, -1).size() == 0);
+};
+
+auto circularBlockWrite = test("CircularBuffer.block_write_and_read_wrap") = []
+{
+    auto buffer = PowerOfTwoBuffer(8);
+    int block[] = {1, 2, 3, 4, 5};
+
+    buffer.write(6, {block, 5});
+    check(buffer[6] == 1);
+    check(buffer[7] == 2);
+    check(buffer[0] == 3);
+    check(buffer[2] == 5);
+
+    int result[5] {};
+    buffer.read(14, {result, 5});
+
+    for (int index = 0; index < 5; ++index)
+        check(result[index] == block[index]);
+
+    const auto& constBuffer = buffer;
+    auto segments = constBuffer.getSegments(7, 2);
+    check(segments.first[0] == 2);
+    check(segments.second[0] == 3);
+};
+
+auto circularEmptySegments =
+    test("CircularBuffer.empty_buffer_has_empty_segments") = []
+{
+    auto buffer = EA::CircularBuffer<float>();
+    check(buffer.getSegments(3, 4).size() == 0);
+};
@@ -0,0 +1,148 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/CircularInterpolation.h>
+#include <cmath>
+#include <vector>
+
+using namespace nano;
+
+namespace
+{
+//buffer[i] = i for one lap, so a read at position p should return p
+template <typename Buffer>
+Buffer makeRampBuffer(int size)
+{
+    auto buffer = Buffer(size);
+
+    for (int index = 0; index < buffer.size(); ++index)
+        buffer[index] = (float) index;
+
+    return buffer;
+}
+
+//Reads numSamples samples from writeIndex with the given delays and checks
+//each one lands on writeIndex + i - delay
+template <typename Interpolator, typename Buffer>
+bool readsRamp(const Buffer& buffer,
+               int writeIndex,
+               const std::vector<float>& delays)
+{
+    auto numSamples = (int) delays.size();
+    auto output = std::vector<float>(delays.size());
+    auto delayView = EA::BufferView<const float>(delays.data(), numSamples);
+
+    EA::readInterpolated<Interpolator>(
+        buffer, writeIndex, delayView, {output.data(), numSamples});
+
+    for (int index = 0; index < numSamples; ++index)
+    {
+        auto expected = (float) (writeIndex + index) - delays[(size_t) index];
+
+        if (std::abs(output[(size_t) index] - expected) > 1e-3f)
+            return false;
+    }
+
+    return true;
+}
+
+std::vector<float> makeDelays(int numSamples, float base, float depth)
+{
+    auto delays = std::vector<float>((size_t) numSamples);
+
+    for (int index = 0; index < numSamples; ++index)
+        delays[(size_t) index] = base + depth * std::sin((float) index * 0.05f);
+
+    return delays;
+}
+} // namespace
+
+auto interpolationIntegerDelays =
+    test("CircularInterpolation.integer_delays_are_exact") = []
+{
+    auto buffer = EA::CircularBuffer<float>(64);
+
+    for (int index = 0; index < 64; ++index)
+        buffer[index] = std::sin((float) index);
+
+    float delays[] = {3.f, 4.f, 10.f, 20.f};
+    float output[4] {};
+
+    auto check4 = [&](auto interpolator)
+    {
+        using Interpolator = decltype(interpolator);
+        EA::readInterpolated<Interpolator>(buffer, 40, {delays, 4}, {output, 4});
+
+        for (int index = 0; index < 4; ++index)
+            check(output[index] == buffer[40 + index - (int) delays[index]]);
+    };
+
+    check4(EA::Interpolators::Linear());
+    check4(EA::Interpolators::Hermite());
+    check4(EA::Interpolators::Lagrange());
+};
+
+auto interpolationRamp = test("CircularInterpolation.polynomials_follow_a_ramp") = []
+{
+    auto buffer = makeRampBuffer<EA::CircularBuffer<float>>(1000);
+    auto delays = makeDelays(300, 50.f, 20.f);
+
+    check(readsRamp<EA::Interpolators::Linear>(buffer, 400, delays));
+    check(readsRamp<EA::Interpolators::Hermite>(buffer, 400, delays));
+    check(readsRamp<EA::Interpolators::Lagrange>(buffer, 400, delays));
+};
+
+auto interpolationWraps =
+    test("CircularInterpolation.blocks_crossing_the_end_wrap") = []
+{
+    using Masked = EA::CircularBuffer<float, EA::CircularIndexing::PowerOfTwo>;
+
+    //With 64 samples the block's range crosses the end of the storage, with
+    //32 it's longer than the whole buffer
+    for (auto size: {64, 32})
+    {
+        auto buffer = Masked(size);
+        auto delays = makeDelays(40, 8.f, 3.f);
+        auto output = std::vector<float>(delays.size());
+
+        for (int index = 0; index < size; ++index)
+            buffer[index] = std::cos((float) index * 0.3f);
+
+        auto writeIndex = size - 4;
+
+        EA::readInterpolated<EA::Interpolators::Hermite>(
+            buffer, writeIndex, {delays.data(), 40}, {output.data(), 40});
+
+        for (int index = 0; index < 40; ++index)
+        {
+            auto position = (float) (writeIndex + index) - delays[(size_t) index];
+            auto whole = (int) std::floor(position);
+            float points[] = {buffer[whole - 1],
+                              buffer[whole],
+                              buffer[whole + 1],
+                              buffer[whole + 2]};
+
+            auto value = EA::Interpolators::Hermite::interpolate(
+                points, position - (float) whole);
+            check(std::abs(output[(size_t) index] - value) < 1e-5f);
+        }
+    }
+};
+
+auto interpolationAllPass =
+    test("CircularInterpolation.all_pass_settles_on_a_ramp") = []
+{
+    auto buffer = makeRampBuffer<EA::CircularBuffer<double>>(1000);
+    auto reader = EA::AllPassReader<double>();
+
+    for (auto delay: {10.3, 10.5, 10.8})
+    {
+        auto delays = std::vector<double>(200, delay);
+        auto output = std::vector<double>(200);
+
+        reader.reset();
+        reader.read(buffer, 500, {delays.data(), 200}, {output.data(), 200});
+
+        //The recursion needs a few samples to settle, then follows the ramp
+        for (int index = 100; index < 200; ++index)
+            check(std::abs(output[(size_t) index] - (500 + index - delay)) < 1e-6);
+    }
+};
@@ -0,0 +1,239 @@
+#include <Helpers/OperationTracker.h>
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/FlatHashMap.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using namespace nano;
+using EA::TestHelpers::OperationTracker;
+
+auto flatHashMapSubscriptInserts = test("FlatHashMap.subscript_inserts") = []
+{
+    auto map = EA::FlatHashMap<int, std::string>();
+    check(map.empty());
+    map[1] = "one";
+    map[2] = "two";
+    check(map.size() == 2);
+    check(map[1] == "one");
+    check(map.size() == 2);
+};
+
+auto flatHashMapGetValue = test("FlatHashMap.getValue") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    check(map.getValue(1) == nullptr);
+
+    for (int key = 0; key < 1000; ++key)
+        map[key] = key * 2;
+
+    check(map.size() == 1000);
+    check(*map.getValue(0) == 0);
+    check(*map.getValue(999) == 1998);
+    check(map.getValue(1000) == nullptr);
+    check(map.contains(500));
+};
+
+auto flatHashMapStringKeys = test("FlatHashMap.string_keys") = []
+{
+    auto map = EA::FlatHashMap<std::string, int>();
+
+    for (int index = 0; index < 200; ++index)
+        map["key" + std::to_string(index)] = index;
+
+    check(*map.getValue("key123") == 123);
+    check(map.getValue("missing") == nullptr);
+};
+
+auto flatHashMapRemove = test("FlatHashMap.remove") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+
+    for (int key = 0; key < 100; ++key)
+        map[key] = key;
+
+    for (int key = 0; key < 100; key += 2)
+        map.remove(key);
+
+    map.remove(12345);
+
+    check(map.size() == 50);
+    check(map.getValue(10) == nullptr);
+    check(*map.getValue(11) == 11);
+};
+
+auto flatHashMapEmplaceExisting = test("FlatHashMap.emplace_keeps_existing") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    map.emplace(3, 30);
+    auto& value = map.emplace(3, 99);
+    check(value == 30);
+    check(map.size() == 1);
+};
+
+auto flatHashMapEraseIf = test("FlatHashMap.eraseIf_on_values") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+
+    for (int key = 0; key < 64; ++key)
+        map[key] = key;
+
+    map.eraseIf([](int value) { return value % 4 != 0; });
+    check(map.size() == 16);
+    check(map.getValue(8) != nullptr);
+    check(map.getValue(9) == nullptr);
+};
+
+auto flatHashMapIteration = test("FlatHashMap.iteration_visits_every_element") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+
+    for (int key = 1; key <= 100; ++key)
+        map[key] = key;
+
+    auto keySum = 0;
+    auto valueSum = 0;
+    auto visited = 0;
+
+    for (auto& element: map)
+    {
+        keySum += element.first;
+        valueSum += element.second;
+        ++visited;
+    }
+
+    check(visited == 100);
+    check(keySum == 5050);
+    check(valueSum == 5050);
+};
+
+auto flatHashMapFind = test("FlatHashMap.find") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    map[4] = 40;
+    const auto& constMap = map;
+    check(constMap.find(4) != constMap.end());
+    check(constMap.find(4)->second == 40);
+    check(constMap.find(5) == constMap.end());
+};
+
+auto flatHashMapReserve = test("FlatHashMap.reserve_avoids_rehash") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    map.reserve(1000);
+    auto capacity = map.getCapacity();
+    check(capacity >= 1000);
+
+    for (int key = 0; key < 1000; ++key)
+        map[key] = key;
+
+    check(map.getCapacity() == capacity);
+};
+
+auto flatHashMapReserveAfterRemove =
+    test("FlatHashMap.reserve_after_remove_counts_deleted_slots") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    map.reserve(896);
+
+    for (int key = 0; key < 896; ++key)
+        map[key] = key;
+
+    for (int key = 0; key < 100; ++key)
+        map.remove(key);
+
+    map.reserve(896);
+    auto capacity = map.getCapacity();
+
+    for (int key = 1000; key < 1100; ++key)
+        map[key] = key;
+
+    check(map.size() == 896);
+    check(map.getCapacity() == capacity);
+};
+
+auto flatHashMapCopyAndMove = test("FlatHashMap.copy_and_move") = []
+{
+    auto map = EA::FlatHashMap<int, std::string>();
+    map[1] = "a";
+    map[2] = "b";
+
+    auto copy = map;
+    copy[3] = "c";
+    check(map.size() == 2);
+    check(copy.size() == 3);
+    check(*copy.getValue(1) == "a");
+
+    auto moved = std::move(copy);
+    check(moved.size() == 3);
+    check(*moved.getValue(3) == "c");
+
+    map = moved;
+    check(map.size() == 3);
+};
+
+auto flatHashMapClear = test("FlatHashMap.clear") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    map[1] = 1;
+    map.clear();
+    check(map.empty());
+    check(map.getValue(1) == nullptr);
+    map[2] = 2;
+    check(map.size() == 1);
+};
+
+auto flatHashMapMatchesStd = test("FlatHashMap.matches_unordered_map") = []
+{
+    auto map = EA::FlatHashMap<int, int>();
+    auto reference = std::unordered_map<int, int>();
+    auto random = std::mt19937(42);
+    auto keys = std::uniform_int_distribution<int>(0, 2000);
+
+    for (int step = 0; step < 50000; ++step)
+    {
+        auto key = keys(random);
+
+        if (step % 3 == 0)
+        {
+            map.remove(key);
+            reference.erase(key);
+        }
+        else
+        {
+            map[key] = step;
+            reference[key] = step;
+        }
+    }
+
+    check(map.size() == (int) reference.size());
+
+    auto allMatch = true;
+
+    for (auto& [key, value]: reference)
+    {
+        auto* found = map.getValue(key);
+        allMatch = allMatch && found != nullptr && *found == value;
+    }
+
+    check(allMatch);
+};
+
+auto flatHashMapDestroysElements = test("FlatHashMap.destroys_every_element") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto map = EA::FlatHashMap<int, OperationTracker>();
+
+        for (int key = 0; key < 300; ++key)
+            map.emplace(key, key);
+
+        for (int key = 0; key < 300; key += 3)
+            map.remove(key);
+
+        check(OperationTracker::counters.live() == 200);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
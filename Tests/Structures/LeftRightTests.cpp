@@ -0,0 +1,123 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/LeftRight.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+auto leftRightModifyRead = test("LeftRight.modify_visible_to_readers") = []
+{
+    auto shared = EA::LeftRight<int>(5);
+    check(*shared.getReader() == 5);
+
+    shared.modify([](int& value) { value += 10; });
+    check(*shared.getReader() == 15);
+    check(shared.read([](const int& value) { return value * 2; }) == 30);
+
+    shared.set(3);
+    check(*shared.getReader() == 3);
+};
+
+auto leftRightReaderSnapshot =
+    test("LeftRight.reader_keeps_its_copy_until_destroyed") = []
+{
+    auto shared = EA::LeftRight<int>(1);
+    auto finished = std::atomic<bool>(false);
+    auto writer = std::thread();
+
+    {
+        auto reader = shared.getReader();
+
+        writer = std::thread(
+            [&]
+            {
+                shared.set(2);
+                finished = true;
+            });
+
+        //The writer can switch copies, but not touch the one being read
+        for (int index = 0; index < 100; ++index)
+        {
+            check(*reader == 1);
+            std::this_thread::yield();
+        }
+
+        check(!finished);
+    }
+
+    writer.join();
+    check(finished);
+    check(*shared.getReader() == 2);
+};
+
+auto leftRightMultipleWriters =
+    test("LeftRight.concurrent_writers_lose_no_changes") = []
+{
+    constexpr int numWriters = 4;
+    constexpr int numChanges = 500;
+
+    auto shared = EA::LeftRight<int>(0);
+    auto writers = std::vector<std::thread>();
+
+    for (int writer = 0; writer < numWriters; ++writer)
+    {
+        writers.emplace_back(
+            [&]
+            {
+                for (int index = 0; index < numChanges; ++index)
+                    shared.modify([](int& value) { ++value; });
+            });
+    }
+
+    for (auto& writer: writers)
+        writer.join();
+
+    check(*shared.getReader() == numWriters * numChanges);
+};
+
+auto leftRightNoTornReads =
+    test("LeftRight.reader_never_sees_a_partial_change") = []
+{
+    struct Pair
+    {
+        int first = 0;
+        int second = 0;
+    };
+
+    auto shared = EA::LeftRight<Pair>();
+    auto done = std::atomic<bool>(false);
+    auto torn = 0;
+
+    auto reader = std::thread(
+        [&]
+        {
+            while (!done)
+            {
+                shared.read(
+                    [&](const Pair& pair)
+                    {
+                        if (pair.first != pair.second)
+                            ++torn;
+                    });
+
+                std::this_thread::yield();
+            }
+        });
+
+    for (int index = 1; index <= 1000; ++index)
+    {
+        shared.modify(
+            [index](Pair& pair)
+            {
+                pair.first = index;
+                pair.second = index;
+            });
+    }
+
+    done = true;
+    reader.join();
+
+    check(torn == 0);
+    check(shared.getReader()->second == 1000);
+};
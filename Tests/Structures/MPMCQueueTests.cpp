@@ -0,0 +1,103 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/MPMCQueue.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+auto mpmcQueuePushPop = test("MPMCQueue.pops_in_push_order") = []
+{
+    auto queue = EA::MPMCQueue<int, 4>();
+    check(queue.tryPush(1));
+    check(queue.tryPush(2));
+
+    auto value = 0;
+    check(queue.tryPop(value) && value == 1);
+    check(queue.tryPop(value) && value == 2);
+    check(!queue.tryPop(value));
+};
+
+auto mpmcQueueFull = test("MPMCQueue.tryPush_fails_when_full") = []
+{
+    auto queue = EA::MPMCQueue<int, 4>();
+
+    for (int index = 0; index < 4; ++index)
+        check(queue.tryPush(index));
+
+    check(!queue.tryPush(4));
+    check(queue.getNumReady() == 4);
+
+    auto value = 0;
+    check(queue.tryPop(value) && value == 0);
+    check(queue.tryPush(4));
+};
+
+auto mpmcQueueWrapAround = test("MPMCQueue.reuses_slots_after_wrap_around") = []
+{
+    auto queue = EA::MPMCQueue<std::string, 2>();
+    auto value = std::string();
+
+    for (int index = 0; index < 50; ++index)
+    {
+        check(queue.tryPush(std::to_string(index)));
+        check(queue.tryPop(value) && value == std::to_string(index));
+    }
+
+    check(queue.isEmpty());
+};
+
+auto mpmcQueueThreads = test("MPMCQueue.delivers_every_message_once") = []
+{
+    constexpr int numThreads = 4;
+    constexpr int messagesPerThread = 20000;
+    constexpr int total = numThreads * messagesPerThread;
+
+    auto queue = EA::MPMCQueue<int, 64>();
+    auto seen = std::vector<std::atomic<int>>((size_t) total);
+    auto received = std::atomic<int>(0);
+    auto threads = std::vector<std::thread>();
+
+    for (int thread = 0; thread < numThreads; ++thread)
+    {
+        threads.emplace_back(
+            [&, thread]
+            {
+                for (int index = 0; index < messagesPerThread;)
+                {
+                    if (queue.tryPush(thread * messagesPerThread + index))
+                        ++index;
+                    else
+                        std::this_thread::yield();
+                }
+            });
+
+        threads.emplace_back(
+            [&]
+            {
+                auto value = 0;
+
+                while (received.load() < total)
+                {
+                    if (queue.tryPop(value))
+                    {
+                        seen[(size_t) value].fetch_add(1);
+                        received.fetch_add(1);
+                    }
+                    else
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    auto allOnce = true;
+
+    for (auto& count: seen)
+        allOnce = allOnce && count.load() == 1;
+
+    check(allOnce);
+};
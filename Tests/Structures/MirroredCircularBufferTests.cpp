@@ -0,0 +1,117 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/MirroredCircularBuffer.h>
+
+using namespace nano;
+
+namespace
+{
+//Runs a test body on a mirrored buffer (where the platform allows it) and on
+//the copying fallback, which have to behave the same
+template <typename Func>
+void forBothModes(int size, Func&& func)
+{
+    for (auto allowMirroring: {true, false})
+    {
+        auto buffer = EA::MirroredCircularBuffer<float>(size, 0.f, allowMirroring);
+        func(buffer);
+    }
+}
+} // namespace
+
+auto mirroredSize = test("MirroredCircularBuffer.size_fills_whole_pages") = []
+{
+    auto buffer = EA::MirroredCircularBuffer<float>(100);
+    auto pageSize = EA::Detail::MirroredMapping::getPageSize();
+    auto pageItems = (int) (pageSize / sizeof(float));
+
+    check(buffer.size() >= pageItems);
+    check((buffer.size() & (buffer.size() - 1)) == 0);
+
+    auto bigger = EA::MirroredCircularBuffer<float>(pageItems * 2 + 1);
+    check(bigger.size() == pageItems * 4);
+};
+
+#if defined(__linux__)
+auto mirroredMapped = test("MirroredCircularBuffer.maps_twice_on_linux") = []
+{
+    auto buffer = EA::MirroredCircularBuffer<float>(1024);
+    check(buffer.isMirrored());
+
+    auto window = buffer.getWindow(buffer.size() - 1, 2);
+    window[1] = 5.f;
+    check(buffer[0] == 5.f);
+};
+#endif
+
+auto mirroredFallback = test("MirroredCircularBuffer.can_fall_back_to_copying") = []
+{
+    auto buffer = EA::MirroredCircularBuffer<float>(1024, 0.f, false);
+    check(!buffer.isMirrored());
+};
+
+auto mirroredIndexing = test("MirroredCircularBuffer.indexes_wrap") = []
+{
+    forBothModes(16,
+                 [](auto& buffer)
+                 {
+                     auto size = buffer.size();
+                     buffer[3] = 1.f;
+                     check(buffer[size + 3] == 1.f);
+                     check(buffer[3 - size] == 1.f);
+                 });
+};
+
+auto mirroredWindows = test("MirroredCircularBuffer.windows_across_the_end") = []
+{
+    forBothModes(16,
+                 [](auto& buffer)
+                 {
+                     auto size = buffer.size();
+
+                     for (int index = 0; index < size; ++index)
+                         buffer[index] = (float) index;
+
+                     //Reading: the window sees the start of the ring after its end
+                     auto window = buffer.getWindow(size - 2, 4);
+                     check(window.size() == 4);
+                     check(window[1] == (float) (size - 1));
+                     check(window[2] == 0.f);
+                     check(window[3] == 1.f);
+
+                     //Writing: changes past the end land at the start
+                     window.applyGain(2.f);
+                     check(buffer[1] == 2.f);
+                     check(buffer[size - 1] == (float) (size - 1) * 2.f);
+                 });
+};
+
+auto mirroredBlocks = test("MirroredCircularBuffer.block_write_and_read") = []
+{
+    forBothModes(16,
+                 [](auto& buffer)
+                 {
+                     float block[] = {1.f, 2.f, 3.f, 4.f, 5.f};
+                     buffer.write(buffer.size() - 3, {block, 5});
+                     check(buffer[-1] == 3.f);
+                     check(buffer[0] == 4.f);
+
+                     float result[5] {};
+                     buffer.read(-3, {result, 5});
+
+                     for (int index = 0; index < 5; ++index)
+                         check(result[index] == block[index]);
+                 });
+};
+
+auto mirroredWholeWindow =
+    test("MirroredCircularBuffer.window_is_at_most_the_size") = []
+{
+    forBothModes(16,
+                 [](auto& buffer)
+                 {
+                     buffer.fill(1.f);
+                     auto window = buffer.getWindow(7, buffer.size() * 2);
+                     check(window.size() == buffer.size());
+                     check(window.getPeak() == 1.f);
+                 });
+};
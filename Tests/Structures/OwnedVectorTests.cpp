@@ -114,3 +114,36 @@ auto ownedVectorCreateDerived =
     check(derived.value() == 42);
     check(v[0]->value() == 42);
 };
+
+auto ownedVectorGrowthKeepsObjects =
+    test("OwnedVector.growth_keeps_the_same_objects") = []
+{
+    auto v = EA::OwnedVector<OwnedItem>();
+    auto* first = &v.createNew(0);
+
+    for (int index = 1; index < 10000; ++index)
+        v.createNew(index);
+
+    check(v[0].get() == first);
+
+    for (int index = 0; index < v.size(); ++index)
+        check(v[index]->value == index);
+};
+
+auto ownedVectorInsertAndRemoveKeepObjects =
+    test("OwnedVector.insert_and_remove_keep_the_same_objects") = []
+{
+    auto v = EA::OwnedVector<OwnedItem>();
+
+    for (int index = 0; index < 100; ++index)
+        v.createNew(index);
+
+    auto* last = v.back().get();
+    v.insertNew(0, -1);
+    v.removeAt(50);
+
+    check(v.size() == 100);
+    check(v[0]->value == -1);
+    check(v.back().get() == last);
+    check(v[50]->value == 50);
+};
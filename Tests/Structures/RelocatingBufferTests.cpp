@@ -0,0 +1,91 @@
+#include <Helpers/OperationTracker.h>
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/RelocatingBuffer.h>
+#include <string>
+#include <vector>
+
+using namespace nano;
+using EA::TestHelpers::OperationTracker;
+
+namespace
+{
+std::vector<std::string> toStd(const EA::RelocatingBuffer<std::string>& buffer)
+{
+    return {buffer.begin(), buffer.end()};
+}
+} // namespace
+
+auto relocatingBufferGrows = test("RelocatingBuffer.emplace_back_grows") = []
+{
+    auto buffer = EA::RelocatingBuffer<std::string>();
+
+    for (int index = 0; index < 100; ++index)
+        buffer.emplace_back(std::to_string(index));
+
+    check(buffer.size() == 100);
+    check(buffer.capacity() >= 100);
+    check(buffer.front() == "0");
+    check(buffer.back() == "99");
+};
+
+auto relocatingBufferInsertErase =
+    test("RelocatingBuffer.insert_and_erase_shift_the_rest") = []
+{
+    auto buffer = EA::RelocatingBuffer<std::string> {"a", "b", "c"};
+    buffer.insert(buffer.begin() + 1, "x");
+    check(toStd(buffer) == std::vector<std::string> {"a", "x", "b", "c"});
+
+    buffer.reserve(10);
+    buffer.insert(buffer.begin(), "y");
+    check(toStd(buffer) == std::vector<std::string> {"y", "a", "x", "b", "c"});
+
+    auto next = buffer.erase(buffer.begin() + 1, buffer.begin() + 3);
+    check(*next == "b");
+    check(toStd(buffer) == std::vector<std::string> {"y", "b", "c"});
+};
+
+auto relocatingBufferInsertOwnElement =
+    test("RelocatingBuffer.insert_own_element_when_full") = []
+{
+    auto buffer = EA::RelocatingBuffer<std::string> {"first", "second"};
+    buffer.insert(buffer.begin(), buffer.back());
+    buffer.emplace_back(buffer.front());
+
+    using Strings = std::vector<std::string>;
+    check(toStd(buffer) == Strings {"second", "first", "second", "second"});
+};
+
+auto relocatingBufferInsertOwnRange =
+    test("RelocatingBuffer.insert_range_from_itself") = []
+{
+    auto buffer = EA::RelocatingBuffer<std::string> {"a", "b"};
+    buffer.insert(buffer.begin() + 1, buffer.begin(), buffer.end());
+
+    check(toStd(buffer) == std::vector<std::string> {"a", "a", "b", "b"});
+};
+
+auto relocatingBufferLifetimes =
+    test("RelocatingBuffer.destroys_every_element_once") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto buffer = EA::RelocatingBuffer<OperationTracker>();
+
+        for (int index = 0; index < 20; ++index)
+            buffer.emplace_back(index);
+
+        buffer.erase(buffer.begin() + 3);
+        buffer.emplace(buffer.begin(), 100);
+        buffer.resize(30);
+        buffer.resize(5);
+
+        auto copy = buffer;
+        auto moved = std::move(copy);
+        check(moved.size() == 5);
+        check(copy.empty());
+        check(moved[0].getValue() == 100);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
@@ -0,0 +1,125 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/SPSCQueue.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+auto spscQueuePushPop = test("SPSCQueue.pops_in_push_order") = []
+{
+    auto queue = EA::SPSCQueue<int, 4>();
+    check(queue.tryPush(1));
+    check(queue.tryPush(2));
+    check(queue.tryPush(3));
+
+    auto value = 0;
+    check(queue.tryPop(value) && value == 1);
+    check(queue.tryPop(value) && value == 2);
+    check(queue.tryPop(value) && value == 3);
+    check(!queue.tryPop(value));
+};
+
+auto spscQueueFull = test("SPSCQueue.tryPush_fails_when_full") = []
+{
+    auto queue = EA::SPSCQueue<int, 3>();
+
+    for (int index = 0; index < 3; ++index)
+        check(queue.tryPush(index));
+
+    check(!queue.tryPush(3));
+    check(queue.getNumReady() == 3);
+
+    auto value = 0;
+    check(queue.tryPop(value) && value == 0);
+    check(queue.tryPush(3));
+};
+
+auto spscQueueWrapAround = test("SPSCQueue.keeps_order_across_wrap_around") = []
+{
+    auto queue = EA::SPSCQueue<int, 5>();
+    auto value = 0;
+
+    for (int index = 0; index < 100; ++index)
+    {
+        check(queue.tryPush(index));
+        check(queue.tryPop(value) && value == index);
+    }
+
+    check(queue.isEmpty());
+};
+
+auto spscQueueBulk = test("SPSCQueue.bulk_push_and_pop") = []
+{
+    auto queue = EA::SPSCQueue<int, 8>();
+    int input[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int output[10] = {};
+
+    check(queue.pushBulk(input, 5) == 5);
+    check(queue.popBulk(output, 3) == 3);
+    check(output[0] == 0 && output[2] == 2);
+
+    //Only 6 free slots left, and this write wraps around the end
+    check(queue.pushBulk(input + 5, 5) == 5);
+    check(queue.pushBulk(input, 10) == 1);
+    check(queue.popBulk(output, 10) == 8);
+    check(output[0] == 3 && output[6] == 9 && output[7] == 0);
+};
+
+auto spscQueueMoveOnlyPayload = test("SPSCQueue.moves_payloads") = []
+{
+    auto queue = EA::SPSCQueue<std::string, 2>();
+    auto message = std::string(100, 'x');
+    check(queue.tryPush(std::move(message)));
+
+    auto popped = std::string();
+    check(queue.tryPop(popped));
+    check(popped.size() == 100);
+};
+
+auto spscQueuePopAll = test("SPSCQueue.popAll") = []
+{
+    auto queue = EA::SPSCQueue<int, 8>();
+    queue.tryPush(1);
+    queue.tryPush(2);
+
+    auto sum = 0;
+    check(queue.popAll([&](int value) { sum += value; }) == 2);
+    check(sum == 3);
+    check(queue.isEmpty());
+};
+
+auto spscQueueThreads = test("SPSCQueue.delivers_every_message_between_threads") = []
+{
+    constexpr int numMessages = 200000;
+    auto queue = EA::SPSCQueue<int, 64>();
+    auto received = std::vector<int>();
+    received.reserve(numMessages);
+
+    auto consumer = std::thread(
+        [&]
+        {
+            auto value = 0;
+
+            while ((int) received.size() < numMessages)
+            {
+                if (queue.tryPop(value))
+                    received.push_back(value);
+            }
+        });
+
+    for (int index = 0; index < numMessages;)
+    {
+        if (queue.tryPush(index))
+            ++index;
+    }
+
+    consumer.join();
+
+    auto inOrder = true;
+
+    for (int index = 0; index < numMessages; ++index)
+        inOrder = inOrder && received[(size_t) index] == index;
+
+    check(inOrder);
+};
@@ -1,5 +1,6 @@
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Structures/SharedGUIData.h>
+#include <vector>
 
 using namespace nano;
 
@@ -36,3 +37,43 @@ auto realTimeToGUIFlag = test("RealTimeToGUI.update_flag_bumps_on_push") = []
     auto after = r.updateFlag.load();
     check(after > before);
 };
+
+auto realTimeToGUIMessagesAll =
+    test("RealTimeToGUIMessages.delivers_every_message") = []
+{
+    auto messages = EA::RealTimeToGUIMessages<int, 8>();
+    messages.push(1);
+    messages.push(2);
+    messages.push(3);
+
+    auto received = std::vector<int>();
+    check(messages.process([&](int value) { received.push_back(value); }) == 3);
+    check(received == std::vector<int> {1, 2, 3});
+};
+
+auto realTimeToGUIMessagesDropped =
+    test("RealTimeToGUIMessages.counts_dropped_messages") = []
+{
+    auto messages = EA::RealTimeToGUIMessages<int, 2>();
+    check(messages.push(1));
+    check(messages.push(2));
+    check(!messages.push(3));
+    check(messages.getNumDropped() == 1);
+};
+
+auto sharedMultiWriterModify =
+    test("SharedWithRealTimeMultiWriter.modify_in_place") = []
+{
+    auto shared = EA::SharedWithRealTimeMultiWriter<std::vector<int>>({1, 2});
+    shared.modify([](std::vector<int>& values) { values.push_back(3); });
+
+    auto values = shared.getRealTime();
+    check(*values == std::vector<int> {1, 2, 3});
+};
+
+auto sharedMultiWriterSet = test("SharedWithRealTimeMultiWriter.set") = []
+{
+    auto shared = EA::SharedWithRealTimeMultiWriter<int>();
+    shared.set(8);
+    check(*shared.getRealTime() == 8);
+};
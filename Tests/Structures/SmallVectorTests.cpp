@@ -1,6 +1,7 @@
 #include <Helpers/OperationTracker.h>
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Structures/SmallVector.h>
+#include <string>
 
 using namespace nano;
 using EA::TestHelpers::OperationTracker;
@@ -289,3 +290,183 @@ auto smallVecResizeGrowStaticDefaultConstructs =
     check(OperationTracker::counters.live() == 3);
     check(v.size() == 3);
 };
+
+auto smallVecNoSecondBuffer =
+    test("SmallVector.holds_one_representation_at_a_time") = []
+{
+    //Begin, end and capacity next to the inline buffer, nothing more
+    check(sizeof(EA::SmallVector<int, 8>) == 3 * sizeof(int*) + 8 * sizeof(int));
+};
+
+auto smallVecReserve = test("SmallVector.reserve_moves_to_the_heap") = []
+{
+    auto v = EA::SmallVector<int, 4> {1, 2};
+    check(v.capacity() == 4);
+
+    v.reserve(3);
+    check(v.isStatic());
+
+    v.reserve(10);
+    check(!v.isStatic());
+    check(v.capacity() == 10);
+    check(v.size() == 2);
+    check(v[1] == 2);
+};
+
+auto smallVecAddOwnElementWhileGrowing =
+    test("SmallVector.add_own_element_while_growing") = []
+{
+    auto v = EA::SmallVector<std::string, 2> {"first", "second"};
+    v.add(v[0]);
+
+    check(!v.isStatic());
+    check(v.size() == 3);
+    check(v[2] == "first");
+};
+
+auto smallVecMoveStatic = test("SmallVector.move_ctor_in_static_mode") = []
+{
+    auto src = EA::SmallVector<OperationTracker, 4>();
+    src.emplace_back(1);
+    src.emplace_back(2);
+
+    OperationTracker::reset();
+    auto dst = std::move(src);
+
+    check(dst.isStatic());
+    check(src.empty());
+    check(OperationTracker::counters.copyConstructions == 0);
+    check(OperationTracker::counters.live() == 0);
+    check(dst.size() == 2);
+    check(dst[1].getValue() == 2);
+};
+
+auto smallVecMoveDynamic = test("SmallVector.move_ctor_steals_heap_block") = []
+{
+    auto src = EA::SmallVector<OperationTracker, 2>();
+
+    for (int i = 1; i <= 5; ++i)
+        src.emplace_back(i);
+
+    auto* block = src.data();
+
+    OperationTracker::reset();
+    auto dst = std::move(src);
+
+    check(dst.data() == block);
+    check(src.empty());
+    check(src.isStatic());
+    check(OperationTracker::counters.moveConstructions == 0);
+    check(dst[4].getValue() == 5);
+};
+
+auto smallVecMoveAssign = test("SmallVector.move_assign_releases_old") = []
+{
+    OperationTracker::reset();
+    {
+        auto a = EA::SmallVector<OperationTracker, 2>();
+        auto b = EA::SmallVector<OperationTracker, 2>();
+
+        for (int i = 1; i <= 3; ++i)
+            a.emplace_back(i);
+
+        b.emplace_back(9);
+        b = std::move(a);
+
+        check(OperationTracker::counters.live() == 3);
+        check(b.size() == 3);
+        check(b[0].getValue() == 1);
+    }
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto smallVecResizeShrink = test("SmallVector.resize_shrink_destroys_tail") = []
+{
+    OperationTracker::reset();
+    auto v = EA::SmallVector<OperationTracker, 2>();
+    v.resize(5);
+    check(!v.isStatic());
+
+    v.resize(1);
+    check(v.size() == 1);
+    check(OperationTracker::counters.live() == 1);
+};
+
+auto smallVecInsert = test("SmallVector.insert_across_the_switch") = []
+{
+    auto v = EA::SmallVector<int, 3> {1, 3, 4};
+    v.insert(1, 2);
+
+    check(!v.isStatic());
+    check(v.size() == 4);
+
+    for (int index = 0; index < 4; ++index)
+        check(v[index] == index + 1);
+};
+
+auto smallVecInsertOwnElement =
+    test("SmallVector.insert_own_element_while_growing") = []
+{
+    auto v = EA::SmallVector<std::string, 2> {"a", "b"};
+    v.insert(0, v[1]);
+
+    check(v.size() == 3);
+    check(v[0] == "b");
+    check(v[1] == "a");
+    check(v[2] == "b");
+};
+
+auto smallVecRemoveAtRelocates =
+    test("SmallVector.removeAt_relocates_without_leaks") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto v = EA::SmallVector<OperationTracker, 2>();
+
+        for (int index = 0; index < 5; ++index)
+            v.create(index);
+
+        v.removeAt(0);
+        v.removeAt(3);
+        check(v.size() == 3);
+
+        for (int index = 0; index < 3; ++index)
+            check(v[index].getValue() == index + 1);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto smallVecUnorderedEraseIf =
+    test("SmallVector.unorderedEraseIf_destroys_matches") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto v = EA::SmallVector<OperationTracker, 2>();
+
+        for (int index = 0; index < 6; ++index)
+            v.create(index);
+
+        check(v.unorderedEraseIf([](const OperationTracker& item)
+                                 { return item.getValue() < 4; }));
+        check(v.size() == 2);
+        check(OperationTracker::counters.live() == 2);
+
+        v.swapRemove(0);
+        check(v.size() == 1);
+        check(OperationTracker::counters.live() == 1);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto smallVecRemoveAllMatches = test("SmallVector.removeAllMatches") = []
+{
+    auto v = EA::SmallVector<int, 4> {1, 2, 1, 3, 1};
+    v.removeAllMatches(1);
+    check(v.size() == 2);
+    check(v[0] == 2);
+    check(v[1] == 3);
+};
@@ -0,0 +1,153 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/SortedMapVector.h>
+#include <string>
+#include <vector>
+
+using namespace nano;
+
+auto sortedMapSubscriptKeepsOrder =
+    test("SortedMapVector.subscript_keeps_keys_sorted") = []
+{
+    auto map = EA::SortedMapVector<int, std::string>();
+    map[3] = "three";
+    map[1] = "one";
+    map[2] = "two";
+    check(map.size() == 3);
+    check(map.getKey(0) == 1);
+    check(map.getKey(1) == 2);
+    check(map.getKey(2) == 3);
+    check(map.get(0) == "one");
+};
+
+auto sortedMapSubscriptReturnsExisting =
+    test("SortedMapVector.subscript_returns_existing") = []
+{
+    auto map = EA::SortedMapVector<int, std::string>();
+    map[1] = "one";
+    auto& existing = map[1];
+    check(existing == "one");
+    check(map.size() == 1);
+};
+
+auto sortedMapGetValue = test("SortedMapVector.getValue") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+
+    for (int key = 0; key < 100; key += 2)
+        map[key] = key * 10;
+
+    check(*map.getValue(0) == 0);
+    check(*map.getValue(42) == 420);
+    check(*map.getValue(98) == 980);
+    check(map.getValue(43) == nullptr);
+    check(map.getValue(-1) == nullptr);
+    check(map.getValue(1000) == nullptr);
+};
+
+auto sortedMapRemove = test("SortedMapVector.remove") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+    map[1] = 100;
+    map[2] = 200;
+    map[3] = 300;
+    map.remove(2);
+    map.remove(7);
+    check(map.size() == 2);
+    check(map.getValue(2) == nullptr);
+    check(*map.getValue(3) == 300);
+};
+
+auto sortedMapEmplaceKeepsExisting =
+    test("SortedMapVector.emplace_keeps_existing") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+    map.emplace(5, 50);
+    auto& value = map.emplace(5, 99);
+    check(map.size() == 1);
+    check(value == 50);
+};
+
+auto sortedMapEraseIf = test("SortedMapVector.eraseIf_on_values") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+
+    for (int key = 0; key < 10; ++key)
+        map[key] = key;
+
+    map.eraseIf([](int value) { return value % 2 == 0; });
+    check(map.size() == 5);
+    check(map.getKey(0) == 1);
+    check(map.getValue(4) == nullptr);
+};
+
+auto sortedMapFind = test("SortedMapVector.find") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+    map[1] = 10;
+    const auto& constMap = map;
+    check(constMap.find(1) != constMap.end());
+    check(constMap.find(2) == constMap.end());
+    check(map.contains(1));
+    check(!map.contains(2));
+};
+
+auto sortedMapCustomCompare = test("SortedMapVector.custom_compare") = []
+{
+    auto map = EA::SortedMapVector<int, int, std::greater<int>>();
+    map[1] = 1;
+    map[3] = 3;
+    map[2] = 2;
+    check(map.getKey(0) == 3);
+    check(map.getKey(2) == 1);
+    check(*map.getValue(2) == 2);
+};
+
+auto sortedMapInsertBatch = test("SortedMapVector.insertBatch_merges_sorted") = []
+{
+    auto map = EA::SortedMapVector<int, std::string>();
+    map[2] = "two";
+    map[5] = "five";
+
+    map.insertBatch({{4, "four"}, {1, "one"}, {5, "FIVE"}, {9, "nine"}});
+
+    check(map.size() == 5);
+    check(map.getKey(0) == 1);
+    check(map.getKey(1) == 2);
+    check(map.getKey(2) == 4);
+    check(map.getKey(3) == 5);
+    check(map.getKey(4) == 9);
+    check(*map.getValue(5) == "FIVE");
+    check(*map.getValue(2) == "two");
+};
+
+auto sortedMapInsertBatchDuplicates =
+    test("SortedMapVector.insertBatch_last_duplicate_wins") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+    auto pairs = std::vector<std::pair<int, int>> {{3, 1}, {1, 1}, {3, 2}, {3, 3}};
+
+    map.insertBatch(pairs);
+
+    check(map.size() == 2);
+    check(*map.getValue(1) == 1);
+    check(*map.getValue(3) == 3);
+};
+
+auto sortedMapInsertBatchIntoEmpty =
+    test("SortedMapVector.insertBatch_into_empty") = []
+{
+    auto map = EA::SortedMapVector<int, int>();
+    auto pairs = std::vector<std::pair<int, int>>();
+
+    for (int key = 99; key >= 0; --key)
+        pairs.emplace_back(key, key * 2);
+
+    map.insertBatch(pairs);
+    check(map.size() == 100);
+
+    for (int index = 0; index < map.size(); ++index)
+    {
+        check(map.getKey(index) == index);
+        check(map.get(index) == index * 2);
+    }
+};
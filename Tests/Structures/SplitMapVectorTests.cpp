@@ -0,0 +1,159 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/SplitMapVector.h>
+#include <string>
+
+using namespace nano;
+
+auto splitMapSubscriptInserts = test("SplitMapVector.subscript_inserts") = []
+{
+    auto map = EA::SplitMapVector<int, std::string>();
+    map[1] = "one";
+    map[2] = "two";
+    check(map.size() == 2);
+    check(map[1] == "one");
+    check(map.size() == 2);
+};
+
+auto splitMapGetValue = test("SplitMapVector.getValue") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+
+    for (int key = 0; key < 100; ++key)
+        map[key * 3] = key;
+
+    check(*map.getValue(0) == 0);
+    check(*map.getValue(3 * 17) == 17);
+    check(*map.getValue(3 * 99) == 99);
+    check(map.getValue(1) == nullptr);
+    check(map.getValue(3 * 100) == nullptr);
+};
+
+auto splitMapNonArithmeticKeys = test("SplitMapVector.non_arithmetic_keys") = []
+{
+    auto map = EA::SplitMapVector<std::string, int>();
+    map["a"] = 1;
+    map["b"] = 2;
+    check(*map.getValue("b") == 2);
+    check(map.getValue("c") == nullptr);
+};
+
+auto splitMapIteratesValues =
+    test("SplitMapVector.iterates_values_contiguously") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+    map[5] = 50;
+    map[6] = 60;
+    map[7] = 70;
+
+    auto sum = 0;
+
+    for (auto value: map)
+        sum += value;
+
+    check(sum == 180);
+    check(&map.get(1) == &map.get(0) + 1);
+    check(map.getKeys().size() == 3);
+};
+
+auto splitMapRemove =
+    test("SplitMapVector.remove_keeps_keys_and_values_aligned") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+    map[1] = 100;
+    map[2] = 200;
+    map[3] = 300;
+    map.remove(2);
+    check(map.size() == 2);
+    check(map.getKey(1) == 3);
+    check(map.get(1) == 300);
+    check(map.getValue(2) == nullptr);
+};
+
+auto splitMapEraseIf = test("SplitMapVector.eraseIf_on_values") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+
+    for (int key = 0; key < 10; ++key)
+        map[key] = key * 10;
+
+    map.eraseIf([](int value) { return value >= 50; });
+    check(map.size() == 5);
+    check(map.getKey(4) == 4);
+    check(map.getValue(7) == nullptr);
+};
+
+auto splitMapSortByKey = test("SplitMapVector.sortByKey") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+    map[3] = 30;
+    map[1] = 10;
+    map[2] = 20;
+    map.sortByKey();
+    check(map.getKey(0) == 1);
+    check(map.get(0) == 10);
+    check(map.getKey(2) == 3);
+    check(map.get(2) == 30);
+};
+
+auto splitMapSortByValueDescending =
+    test("SplitMapVector.sortByValue_forward_false_is_descending") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+    map[1] = 300;
+    map[2] = 100;
+    map[3] = 200;
+    map.sortByValue(false);
+    check(map.get(0) == 300);
+    check(map.getKey(0) == 1);
+    check(map.get(2) == 100);
+    check(map.getKey(2) == 2);
+};
+
+auto splitMapGetKeyByValue = test("SplitMapVector.getKeyByValue") = []
+{
+    auto map = EA::SplitMapVector<int, int>();
+    map[7] = 42;
+    map[8] = 99;
+    check(*map.getKeyByValue(99) == 8);
+    check(map.getKeyByValue(1) == nullptr);
+    check(map.hasMatch(42));
+};
+
+auto splitMapBoolKeys = test("SplitMapVector.bool_keys") = []
+{
+    auto map = EA::SplitMapVector<bool, std::string>();
+    map[true] = "yes";
+    map[false] = "no";
+
+    check(map.size() == 2);
+    check(map.getIndexOf(false) == 1);
+    check(map[true] == "yes");
+    check(map.contains(false));
+};
+
+auto splitMapBoolKeyAccess = test("SplitMapVector.bool_keys_by_index_and_value") = []
+{
+    auto map = EA::SplitMapVector<bool, int>();
+    map[true] = 1;
+    map[false] = 2;
+
+    check(map.getKey(0) == true);
+    check(map.getKey(1) == false);
+    check(*map.getKeyByValue(2) == false);
+    check(map.getKeyByValue(3) == nullptr);
+};
+
+auto splitMapBoolKeySort = test("SplitMapVector.sortByKey_with_bool_keys") = []
+{
+    auto map = EA::SplitMapVector<bool, int>();
+    map[true] = 1;
+    map[false] = 2;
+
+    map.sortByKey();
+    check(map.getKey(0) == false);
+    check(map.get(0) == 2);
+
+    map.sortByValue(false);
+    check(map.getKey(0) == false);
+    check(map.get(1) == 1);
+};
@@ -1,6 +1,7 @@
 #include <Helpers/OperationTracker.h>
 #include <NanoTest/NanoTest.h>
 #include <ea_data_structures/Structures/StaticVector.h>
+#include <string>
 
 using namespace nano;
 using EA::TestHelpers::OperationTracker;
@@ -343,3 +344,89 @@ auto staticVecAddBeyondCapacityDoesntTouch =
     check(OperationTracker::counters.moveConstructions == 0);
     check(v.size() == 2);
 };
+
+auto staticVecInsert = test("StaticVector.insert_shifts_the_rest_up") = []
+{
+    auto v = EA::StaticVector<std::string, 4> {"a", "c"};
+    v.insert(1, "b");
+    v.insert(3, "d");
+
+    check(v.size() == 4);
+    check(v[0] == "a");
+    check(v[1] == "b");
+    check(v[2] == "c");
+    check(v[3] == "d");
+
+    v.insert(0, "e");
+    check(v.size() == 4);
+    check(v[0] == "a");
+};
+
+auto staticVecInsertOwnElement = test("StaticVector.insert_own_element") = []
+{
+    auto v = EA::StaticVector<std::string, 4> {"a", "b"};
+    v.insert(0, v[1]);
+
+    check(v.size() == 3);
+    check(v[0] == "b");
+    check(v[1] == "a");
+    check(v[2] == "b");
+};
+
+auto staticVecRemoveAtRelocates =
+    test("StaticVector.removeAt_relocates_without_leaks") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto v = EA::StaticVector<OperationTracker, 4>();
+
+        for (int index = 0; index < 4; ++index)
+            v.create(index);
+
+        v.removeAt(1);
+        check(v.size() == 3);
+        check(v[0].getValue() == 0);
+        check(v[1].getValue() == 2);
+        check(v[2].getValue() == 3);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto staticVecUnorderedEraseIf =
+    test("StaticVector.unorderedEraseIf_destroys_matches") = []
+{
+    OperationTracker::reset();
+
+    {
+        auto v = EA::StaticVector<OperationTracker, 8>();
+
+        for (int index = 0; index < 6; ++index)
+            v.create(index);
+
+        check(v.unorderedEraseIf([](const OperationTracker& item)
+                                 { return item.getValue() % 2 == 0; }));
+        check(v.size() == 3);
+        check(OperationTracker::counters.live() == 3);
+
+        for (auto& item: v)
+            check(item.getValue() % 2 == 1);
+
+        v.swapRemove(0);
+        check(v.size() == 2);
+        check(OperationTracker::counters.live() == 2);
+    }
+
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto staticVecRemoveAllMatches =
+    test("StaticVector.removeAllMatches_keeps_order") = []
+{
+    auto v = EA::StaticVector<int, 8> {1, 2, 1, 3, 1};
+    check(v.removeAllMatches(1) == 3);
+    check(v.size() == 2);
+    check(v[0] == 2);
+    check(v[1] == 3);
+};
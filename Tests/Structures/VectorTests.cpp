@@ -1,5 +1,7 @@
 #include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/SpecialVectors.h>
 #include <ea_data_structures/Structures/Vector.h>
+#include <string>
 #include <type_traits>
 
 using namespace nano;
@@ -197,3 +199,120 @@ auto vectorEqualityConst = test("Vector.operator==_works_on_const") = []
     check(a == b);
     check(!(a != b));
 };
+
+auto vectorReserveAtLeastGrows =
+    test("Vector.reserveAtLeast_grows_geometrically") = []
+{
+    auto v = EA::Vector<int>();
+    v.reserveAtLeast(10);
+    check(v.capacity() >= 10);
+
+    auto reserved = v.capacity();
+    v.reserveAtLeast(reserved + 1);
+    check(v.capacity() >= reserved * 2);
+
+    v.reserveAtLeast(5);
+    check(v.capacity() >= reserved * 2);
+};
+
+auto vectorExactGrowth = test("Vector.exact_growth_reserves_what_is_asked") = []
+{
+    auto v = EA::Vector<int, std::allocator<int>, EA::Growth::Exact>();
+    v.reserveAtLeast(10);
+    v.reserveAtLeast(11);
+    check(v.capacity() == 11);
+};
+
+auto vectorFactorGrowth = test("Vector.factor_growth_when_adding") = []
+{
+    auto v = EA::Vector<int, std::allocator<int>, EA::Growth::Factor<3, 2>>();
+
+    for (int index = 0; index < 5; ++index)
+        v.add(index);
+
+    //1, 2, 3, 4, then 4 * 1.5
+    check(v.capacity() == 6);
+
+    for (int index = 5; index < 7; ++index)
+        v.add(index);
+
+    check(v.capacity() == 9);
+
+    for (int index = 0; index < 7; ++index)
+        check(v[index] == index);
+};
+
+auto vectorFactorGrowthOwnElement =
+    test("Vector.factor_growth_adds_own_element_while_full") = []
+{
+    using Strings =
+        EA::Vector<std::string, std::allocator<std::string>, EA::Growth::Factor<2>>;
+
+    auto v = Strings();
+    v.add(std::string(40, 'a'));
+    check(v.capacity() == 1);
+
+    v.add(v[0]);
+    v.create(v[1]);
+
+    check(v.size() == 3);
+    check(v[2] == std::string(40, 'a'));
+};
+
+auto vectorDefaultInitResize = test("Vector.default_init_resize") = []
+{
+    auto v = EA::DefaultInitVector<float>(4);
+    check(v.size() == 4);
+
+    v.fill(1.f);
+    v.resizeUninitialized(64);
+    check(v.size() == 64);
+
+    for (int index = 0; index < 4; ++index)
+        check(v[index] == 1.f);
+
+    v.resize(66, 2.f);
+    check(v[65] == 2.f);
+};
+
+auto vectorDefaultInitClasses =
+    test("Vector.default_init_still_constructs_classes") = []
+{
+    auto v = EA::DefaultInitVector<std::string>();
+    v.resizeDefaultInit(3);
+    check(v.size() == 3);
+    check(v[2].empty());
+
+    v.add("text");
+    check(v.back() == "text");
+};
+
+auto vectorRemoveIndexes = test("Vector.removeIndexes_keeps_order") = []
+{
+    auto v = EA::Vector<int> {10, 20, 30, 40, 50};
+    auto indexes = EA::Vector<int> {4, 0, 2};
+
+    check(v.removeIndexes(indexes) == 3);
+    check(v == EA::Vector<int> {20, 40});
+};
+
+auto vectorRemoveIndexesMatching = test("Vector.removeIndexesMatching") = []
+{
+    auto v = EA::Vector<int> {1, 2, 3, 4, 5};
+    v.removeIndexesMatching([](int x) { return x < 3; });
+    check(v == EA::Vector<int> {3, 4, 5});
+};
+
+auto vectorSwapRemove = test("Vector.swapRemove") = []
+{
+    auto v = EA::Vector<std::string> {"a", "b", "c"};
+    v.swapRemove(0);
+    check(v == EA::Vector<std::string> {"c", "b"});
+};
+
+auto vectorUnorderedEraseIf = test("Vector.unorderedEraseIf") = []
+{
+    auto v = EA::Vector<int> {1, 2, 3, 4};
+    check(v.unorderedEraseIf([](int x) { return x < 3; }));
+    check(v == EA::Vector<int> {4, 3});
+};
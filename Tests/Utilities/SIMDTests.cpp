@@ -0,0 +1,269 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Structures/Array.h>
+#include <ea_data_structures/Structures/SmallVector.h>
+#include <ea_data_structures/Structures/Vector.h>
+#include <ea_data_structures/Utilities/SIMD.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace nano;
+
+namespace
+{
+//Sizes around the register widths, so both the vector loop and the scalar
+//remainder get exercised
+constexpr int sizes[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100};
+
+template <typename T>
+std::vector<T> makeRamp(int size, T start)
+{
+    auto result = std::vector<T>((size_t) size);
+
+    for (int index = 0; index < size; ++index)
+        result[(size_t) index] = start + (T) index;
+
+    return result;
+}
+
+template <typename T>
+bool matchesScalar()
+{
+    for (auto size: sizes)
+    {
+        auto source = makeRamp<T>(size, (T) 1);
+        auto other = makeRamp<T>(size, (T) 3);
+        auto expected = makeRamp<T>(size, (T) 2);
+        auto actual = expected;
+
+        EA::SIMD::Scalar::mix(expected.data(), source.data(), size);
+        EA::SIMD::mix(actual.data(), source.data(), size);
+
+        EA::SIMD::Scalar::mixWithGain(expected.data(), source.data(), (T) 2, size);
+        EA::SIMD::mixWithGain(actual.data(), source.data(), (T) 2, size);
+
+        EA::SIMD::Scalar::scale(expected.data(), (T) 3, size);
+        EA::SIMD::scale(actual.data(), (T) 3, size);
+
+        EA::SIMD::Scalar::multiplyAdd(
+            expected.data(), source.data(), other.data(), size);
+        EA::SIMD::multiplyAdd(actual.data(), source.data(), other.data(), size);
+
+        EA::SIMD::Scalar::multiply(expected.data(), source.data(), size);
+        EA::SIMD::multiply(actual.data(), source.data(), size);
+
+        if (actual != expected)
+            return false;
+
+        EA::SIMD::fill(actual.data(), (T) 5, size);
+
+        for (auto value: actual)
+        {
+            if (value != (T) 5)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//Alternating signs, so the peak and the minimum come from different samples
+template <typename T>
+std::vector<T> makeSignal(int size)
+{
+    auto result = makeRamp<T>(size, (T) 1);
+
+    for (int index = 1; index < size; index += 2)
+        result[(size_t) index] = -result[(size_t) index] * (T) 2;
+
+    return result;
+}
+
+//Integer valued samples keep every sum exact, whatever the summing order
+template <typename T>
+bool reductionsMatchScalar()
+{
+    for (auto size: sizes)
+    {
+        auto signal = makeSignal<T>(size);
+        auto expected = EA::SIMD::Scalar::findMinMax(signal.data(), size);
+        auto actual = EA::SIMD::findMinMax(signal.data(), size);
+
+        if (actual.min != expected.min || actual.max != expected.max)
+            return false;
+
+        if (EA::SIMD::findPeak(signal.data(), size)
+            != EA::SIMD::Scalar::findPeak(signal.data(), size))
+            return false;
+
+        if (EA::SIMD::sumOfSquares(signal.data(), size)
+            != EA::SIMD::Scalar::sumOfSquares(signal.data(), size))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+bool interleaveRoundTrips(int numChannels)
+{
+    for (auto size: sizes)
+    {
+        auto channels = std::vector<std::vector<T>>();
+        auto pointers = std::vector<T*>();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            channels.push_back(makeRamp<T>(size, (T) (channel * 1000)));
+
+        for (auto& channel: channels)
+            pointers.push_back(channel.data());
+
+        auto interleaved = std::vector<T>((size_t) (size * numChannels));
+        auto* frames = interleaved.data();
+        EA::SIMD::interleave<T>(frames, pointers.data(), numChannels, size);
+
+        for (int index = 0; index < size * numChannels; ++index)
+        {
+            auto& channel = channels[(size_t) (index % numChannels)];
+
+            if (frames[index] != channel[(size_t) (index / numChannels)])
+                return false;
+        }
+
+        auto copies = channels;
+
+        for (auto& channel: channels)
+            std::fill(channel.begin(), channel.end(), (T) 0);
+
+        EA::SIMD::deinterleave(pointers.data(), frames, numChannels, size);
+
+        if (channels != copies)
+            return false;
+    }
+
+    return true;
+}
+} // namespace
+
+auto simdFloat = test("SIMD.float_kernels_match_scalar") = []
+{
+    check(matchesScalar<float>());
+};
+
+auto simdDouble = test("SIMD.double_kernels_match_scalar") = []
+{
+    check(matchesScalar<double>());
+};
+
+auto simdInt = test("SIMD.int_kernels_match_scalar") = []
+{
+    check(matchesScalar<int>());
+};
+
+auto simdVectorMix = test("SIMD.Vector_mixFrom_and_fill") = []
+{
+    auto vec = EA::Vector<float>(19);
+    auto other = EA::Vector<float>(19);
+    vec.fill(1.f);
+    other.fill(0.5f);
+    vec.mixFrom(other);
+
+    for (auto value: vec)
+        check(value == 1.5f);
+};
+
+auto simdArrayMix = test("SIMD.Array_mixFrom_from_std_vector") = []
+{
+    auto arr = EA::Array<double, 5>();
+    arr.fill(2.0);
+
+    auto other = std::vector<double> {1.0, 2.0, 3.0, 4.0, 5.0};
+    arr.mixFrom(other);
+
+    check(arr[0] == 3.0 && arr[4] == 7.0);
+};
+
+auto simdSmallVectorMix = test("SIMD.SmallVector_mixFrom_and_fill") = []
+{
+    auto vec = EA::SmallVector<float, 4>();
+    vec.resize(10);
+    vec.fill(1.f);
+
+    auto other = EA::SmallVector<float, 4>();
+    other.resize(10);
+    other.fill(2.f);
+
+    vec.mixFrom(other);
+    check(vec[0] == 3.f && vec[9] == 3.f);
+};
+
+auto simdNonArithmetic =
+    test("SIMD.non_arithmetic_containers_use_plain_loops") = []
+{
+    auto vec = EA::Vector<std::string>(3);
+    vec.fill("a");
+
+    auto other = EA::Vector<std::string>(3);
+    other.fill("b");
+    vec.mixFrom(other);
+
+    check(vec[2] == "ab");
+};
+
+auto simdReductions = test("SIMD.min_max_peak_and_sum_of_squares_match_scalar") = []
+{
+    check(reductionsMatchScalar<float>());
+    check(reductionsMatchScalar<double>());
+    check(reductionsMatchScalar<int>());
+};
+
+auto simdEmptyReductions = test("SIMD.reductions_of_empty_buffers_are_zero") = []
+{
+    auto* none = static_cast<const float*>(nullptr);
+    auto range = EA::SIMD::findMinMax(none, 0);
+
+    check(range.min == 0.f && range.max == 0.f);
+    check(EA::SIMD::findPeak(none, 0) == 0.f);
+    check(EA::SIMD::getRMS(none, 0) == 0.f);
+};
+
+auto simdRMS = test("SIMD.rms_of_a_square_wave_is_its_amplitude") = []
+{
+    auto signal = std::vector<double>(37);
+
+    for (size_t index = 0; index < signal.size(); ++index)
+        signal[index] = index % 2 == 0 ? 0.5 : -0.5;
+
+    check(EA::SIMD::getRMS(signal.data(), (int) signal.size()) == 0.5);
+};
+
+auto simdGainRamp = test("SIMD.gain_ramp_continues_across_blocks") = []
+{
+    for (auto size: sizes)
+    {
+        auto whole = std::vector<float>((size_t) size * 2, 1.f);
+        auto halves = whole;
+
+        EA::SIMD::applyGainRamp(whole.data(), 0.f, 1.f, size * 2);
+        EA::SIMD::applyGainRamp(halves.data(), 0.f, 0.5f, size);
+        EA::SIMD::applyGainRamp(halves.data() + size, 0.5f, 1.f, size);
+
+        for (int index = 0; index < size * 2; ++index)
+        {
+            auto expected = (float) index / (float) (size * 2);
+            check(std::abs(whole[(size_t) index] - expected) < 1e-6f);
+            check(std::abs(halves[(size_t) index] - expected) < 1e-6f);
+        }
+    }
+};
+
+auto simdInterleave = test("SIMD.interleave_and_deinterleave_round_trip") = []
+{
+    for (int numChannels = 1; numChannels <= 3; ++numChannels)
+    {
+        check(interleaveRoundTrips<float>(numChannels));
+        check(interleaveRoundTrips<double>(numChannels));
+        check(interleaveRoundTrips<int>(numChannels));
+    }
+};
@@ -0,0 +1,81 @@
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Utilities/ThreadPool.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace nano;
+
+auto threadPoolRunsAll = test("ThreadPool.run_calls_every_index_once") = []
+{
+    auto pool = EA::ThreadPool(3);
+    auto counts = std::vector<std::atomic<int>>(1000);
+
+    pool.run(1000, [&](int index) { counts[(size_t) index].fetch_add(1); });
+
+    for (auto& count: counts)
+        check(count.load() == 1);
+};
+
+auto threadPoolRepeatedRuns = test("ThreadPool.repeated_runs_finish") = []
+{
+    auto pool = EA::ThreadPool(2);
+    auto total = std::atomic<int>(0);
+
+    for (int round = 0; round < 200; ++round)
+        pool.run(8, [&](int index) { total.fetch_add(index); });
+
+    check(total.load() == 200 * 28);
+};
+
+auto threadPoolWaitsForSlowTasks =
+    test("ThreadPool.run_waits_for_tasks_still_running") = []
+{
+    auto pool = EA::ThreadPool(2);
+    auto finished = std::vector<std::atomic<bool>>(3);
+
+    pool.run(3,
+             [&](int index)
+             {
+                 if (index > 0)
+                     std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+                 finished[(size_t) index].store(true);
+             });
+
+    for (auto& flag: finished)
+        check(flag.load());
+};
+
+auto threadPoolNested = test("ThreadPool.run_can_nest_in_a_task") = []
+{
+    auto pool = EA::ThreadPool(2);
+    auto total = std::atomic<int>(0);
+
+    pool.run(4,
+             [&](int)
+             { pool.run(4, [&](int inner) { total.fetch_add(inner + 1); }); });
+
+    check(total.load() == 4 * 10);
+};
+
+auto threadPoolNoWorkers = test("ThreadPool.without_workers_runs_inline") = []
+{
+    auto pool = EA::ThreadPool(0);
+    auto order = std::vector<int>();
+
+    pool.run(4, [&](int index) { order.push_back(index); });
+
+    check(pool.getNumWorkers() == 0);
+    check(order == std::vector<int> {0, 1, 2, 3});
+};
+
+auto threadPoolNoTasks = test("ThreadPool.zero_tasks_is_a_no_op") = []
+{
+    auto pool = EA::ThreadPool(2);
+    auto calls = 0;
+
+    pool.run(0, [&](int) { ++calls; });
+    check(calls == 0);
+};
@@ -224,3 +224,206 @@ auto vectorsRemoveAllMatches = test("Vectors.removeAllMatches_counts") = []
     check(removed == 3);
     check(v.size() == 2u);
 };
+
+auto vectorsRemoveIndexes = test("Vectors.removeIndexes_in_one_pass") = []
+{
+    auto v = std::vector<int> {0, 1, 2, 3, 4, 5, 6};
+    auto indexes = std::vector<int> {5, 1, 1, -2, 3, 40};
+    auto removed = EA::Vectors::removeIndexes(v, indexes);
+
+    check(removed == 3);
+    check(v == std::vector<int> {0, 2, 4, 6});
+};
+
+auto vectorsRemoveIndexesNone = test("Vectors.removeIndexes_out_of_range") = []
+{
+    auto v = std::vector<int> {0, 1, 2};
+    auto indexes = std::vector<int> {3, 4};
+
+    check(EA::Vectors::removeIndexes(v, indexes) == 0);
+    check(v.size() == 3u);
+};
+
+auto vectorsUnorderedEraseIf =
+    test("Vectors.unorderedEraseIf_fills_from_the_end") = []
+{
+    auto v = std::vector<int> {1, 2, 3, 4, 5, 6};
+    auto erased = EA::Vectors::unorderedEraseIf(v, [](int x) { return x % 2 == 1; });
+
+    check(erased);
+    check(v == std::vector<int> {6, 2, 4});
+    check(!EA::Vectors::unorderedEraseIf(v, [](int x) { return x > 10; }));
+};
+
+auto vectorsSwapRemove = test("Vectors.swapRemove_moves_the_last_in") = []
+{
+    auto v = std::vector<int> {1, 2, 3, 4};
+    EA::Vectors::swapRemove(v, 0);
+    check(v == std::vector<int> {4, 2, 3});
+
+    EA::Vectors::swapRemove(v, 2);
+    check(v == std::vector<int> {4, 2});
+
+    EA::Vectors::swapRemove(v, 5);
+    check(v.size() == 2u);
+};
+
+namespace
+{
+//Parallel from a handful of elements, on a pool of its own
+EA::Execution::Parallel getTestPolicy()
+{
+    static auto pool = EA::ThreadPool(3);
+
+    auto policy = EA::Execution::Parallel();
+    policy.pool = &pool;
+    policy.minParallelSize = 2;
+
+    return policy;
+}
+
+std::vector<int> getShuffled(int size)
+{
+    auto v = std::vector<int>();
+
+    for (int index = 0; index < size; ++index)
+        v.push_back((index * 7919) % size);
+
+    return v;
+}
+} // namespace
+
+auto vectorsStableSortBackwardKeepsOrder =
+    test("Vectors.stableSort_backward_keeps_equal_elements_in_order") = []
+{
+    auto v = std::vector<std::pair<int, int>> {{1, 0}, {2, 1}, {1, 2}, {2, 3}};
+    auto byFirst = [](auto& a, auto& b) { return a.first < b.first; };
+
+    EA::Vectors::stableSort(v, byFirst, false);
+
+    using Pairs = std::vector<std::pair<int, int>>;
+    check(v == Pairs {{2, 1}, {2, 3}, {1, 0}, {1, 2}});
+};
+
+auto vectorsParallelSort = test("Vectors.parallel_sort_matches_serial") = []
+{
+    auto policy = getTestPolicy();
+
+    for (auto size: {0, 1, 5, 1000, 4099})
+    {
+        auto v = getShuffled(size);
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+
+        EA::Vectors::sort(policy, v);
+        check(v == expected);
+
+        EA::Vectors::sort(policy, v, false);
+        std::reverse(expected.begin(), expected.end());
+        check(v == expected);
+    }
+};
+
+auto vectorsParallelStableSort =
+    test("Vectors.parallel_stableSort_keeps_equal_elements_in_order") = []
+{
+    auto v = std::vector<std::pair<int, int>>();
+
+    for (int index = 0; index < 3000; ++index)
+        v.emplace_back((index * 31) % 10, index);
+
+    auto expected = v;
+    auto byFirst = [](auto& a, auto& b) { return a.first < b.first; };
+    std::stable_sort(expected.begin(), expected.end(), byFirst);
+
+    EA::Vectors::stableSort(getTestPolicy(), v, byFirst);
+    check(v == expected);
+};
+
+auto vectorsParallelSeqPolicy = test("Vectors.seq_policy_runs_serially") = []
+{
+    auto v = std::vector<int> {3, 1, 2};
+    EA::Vectors::sort(EA::Execution::seq, v);
+    check(v == std::vector<int> {1, 2, 3});
+
+    auto found = EA::Vectors::getIndexOf(EA::Execution::seq, v, 3);
+    check(found == 2);
+};
+
+auto vectorsParallelTransform =
+    test("Vectors.parallel_transform_maps_each_element") = []
+{
+    auto src = EA::Vector<int>();
+
+    for (int index = 0; index < 1000; ++index)
+        src.add(index);
+
+    auto dst = EA::Vectors::transform(
+        getTestPolicy(), src, [](int x) { return (float) x * 0.5f; });
+
+    check(dst.size() == 1000);
+
+    for (int index = 0; index < 1000; ++index)
+        check(dst[index] == (float) index * 0.5f);
+};
+
+auto vectorsParallelTransformToBool =
+    test("Vectors.parallel_transform_to_bool") = []
+{
+    auto src = getShuffled(100003);
+
+    auto isEven = EA::Vectors::transform(
+        getTestPolicy(), src, [](int x) { return x % 2 == 0; });
+
+    check(isEven.size() == src.size());
+
+    for (int index = 0; index < (int) src.size(); ++index)
+        check(isEven[(size_t) index] == (src[(size_t) index] % 2 == 0));
+};
+
+auto vectorsParallelFilter = test("Vectors.parallel_filter_keeps_order") = []
+{
+    auto v = getShuffled(1000);
+    auto isOdd = [](int x) { return x % 2 == 1; };
+
+    auto result = EA::Vectors::filter(getTestPolicy(), v, isOdd);
+    check(result == EA::Vectors::filter(v, isOdd));
+};
+
+auto vectorsParallelFold = test("Vectors.parallel_fold_with_associative_func") = []
+{
+    auto v = getShuffled(1000);
+
+    auto sum = EA::Vectors::fold(getTestPolicy(), v, std::plus<>());
+    check(sum == 999 * 1000 / 2);
+
+    auto maximum = EA::Vectors::fold(
+        getTestPolicy(), v, [](int a, int b) { return std::max(a, b); });
+    check(maximum == 999);
+};
+
+auto vectorsParallelEraseIf = test("Vectors.parallel_eraseIf_keeps_order") = []
+{
+    auto v = getShuffled(1000);
+    auto expected = v;
+    auto isSmall = [](int x) { return x < 700; };
+
+    check(EA::Vectors::eraseIf(getTestPolicy(), v, isSmall));
+    EA::Vectors::eraseIf(expected, isSmall);
+
+    check(v == expected);
+    check(!EA::Vectors::eraseIf(getTestPolicy(), v, isSmall));
+};
+
+auto vectorsParallelGetIndexOf =
+    test("Vectors.parallel_getIndexOf_finds_the_first_match") = []
+{
+    auto v = std::vector<int>(20000, 0);
+    v[9000] = 5;
+    v[15000] = 5;
+    v[19999] = 7;
+
+    check(EA::Vectors::getIndexOf(getTestPolicy(), v, 5) == 9000);
+    check(EA::Vectors::getIndexOf(getTestPolicy(), v, 7) == 19999);
+    check(EA::Vectors::getIndexOf(getTestPolicy(), v, 3) == -1);
+};
@@ -0,0 +1,157 @@
+#include <Helpers/OperationTracker.h>
+#include <NanoTest/NanoTest.h>
+#include <ea_data_structures/Pointers/Ref.h>
+#include <ea_data_structures/Pointers/RefOrOwn.h>
+#include <ea_data_structures/Structures/SmallVector.h>
+#include <ea_data_structures/Structures/SpecialVectors.h>
+#include <ea_data_structures/ValueWrapper/RawStorage.h>
+#include <ea_data_structures/ValueWrapper/Relocation.h>
+#include <string>
+
+using namespace nano;
+using EA::TestHelpers::OperationTracker;
+
+namespace
+{
+//Opted in, and counts the moves that still happen
+struct RelocatableHandle
+{
+    explicit RelocatableHandle(int valueToUse) noexcept
+        : value(valueToUse)
+    {
+    }
+
+    RelocatableHandle(RelocatableHandle&& other) noexcept
+        : value(other.value)
+    {
+        ++moves;
+    }
+
+    RelocatableHandle& operator=(RelocatableHandle&&) = default;
+
+    inline static int moves = 0;
+    int value = 0;
+};
+} // namespace
+
+template <>
+struct EA::TriviallyRelocatable<RelocatableHandle> : std::true_type
+{
+};
+
+static_assert(EA::isTriviallyRelocatable<int>());
+static_assert(EA::isTriviallyRelocatable<const float>());
+static_assert(EA::isTriviallyRelocatable<EA::OwningPointer<std::string>>());
+static_assert(EA::isTriviallyRelocatable<EA::Ref<std::string>>());
+static_assert(EA::isTriviallyRelocatable<EA::RefOrOwn<std::string>>());
+static_assert(EA::isTriviallyRelocatable<RelocatableHandle>());
+static_assert(!EA::isTriviallyRelocatable<OperationTracker>());
+
+auto relocationCopiesOptedInBytes =
+    test("Relocation.relocate_owning_pointers_keeps_ownership") = []
+{
+    EA::RawStorage<EA::OwningPointer<int>> source[3];
+    EA::RawStorage<EA::OwningPointer<int>> dest[3];
+
+    for (int index = 0; index < 3; ++index)
+        source[index].create(new int(index));
+
+    EA::Relocation::relocate(source[0].get(), 3, dest[0].get());
+
+    for (int index = 0; index < 3; ++index)
+    {
+        check(**dest[index] == index);
+        dest[index].destroy();
+    }
+};
+
+auto relocationMovesOthers =
+    test("Relocation.relocate_moves_and_destroys_other_types") = []
+{
+    OperationTracker::reset();
+
+    EA::RawStorage<OperationTracker> source[2];
+    EA::RawStorage<OperationTracker> dest[2];
+
+    source[0].create(1);
+    source[1].create(2);
+
+    EA::Relocation::relocate(source[0].get(), 2, dest[0].get());
+
+    check(OperationTracker::counters.moveConstructions == 2);
+    check(OperationTracker::counters.destructions == 2);
+    check(dest[0]->getValue() == 1);
+    check(dest[1]->getValue() == 2);
+
+    dest[0].destroy();
+    dest[1].destroy();
+    check(OperationTracker::counters.live() == 0);
+};
+
+auto relocationOverlapUp = test("Relocation.overlapping_shift_up") = []
+{
+    EA::RawStorage<std::string> slots[4];
+
+    for (int index = 0; index < 3; ++index)
+        slots[index].create(std::string(30, char('a' + index)));
+
+    EA::Relocation::relocateOverlapping(slots[0].get(), 3, slots[1].get());
+
+    for (int index = 1; index < 4; ++index)
+    {
+        check(*slots[index] == std::string(30, char('a' + index - 1)));
+        slots[index].destroy();
+    }
+};
+
+auto relocationOverlapDown = test("Relocation.overlapping_shift_down") = []
+{
+    EA::RawStorage<EA::OwningPointer<int>> slots[4];
+
+    for (int index = 1; index < 4; ++index)
+        slots[index].create(new int(index));
+
+    EA::Relocation::relocateOverlapping(slots[1].get(), 3, slots[0].get());
+
+    for (int index = 0; index < 3; ++index)
+    {
+        check(**slots[index] == index + 1);
+        slots[index].destroy();
+    }
+};
+
+auto relocationSmallVectorGrowth =
+    test("Relocation.small_vector_growth_skips_opted_in_moves") = []
+{
+    RelocatableHandle::moves = 0;
+
+    auto vec = EA::SmallVector<RelocatableHandle, 4>();
+
+    for (int index = 0; index < 1000; ++index)
+        vec.create(index);
+
+    for (int index = 0; index < 1000; ++index)
+        check(vec[index].value == index);
+
+    check(RelocatableHandle::moves == 0);
+};
+
+auto relocationRelocatingVector =
+    test("Relocation.relocating_vector_skips_opted_in_moves") = []
+{
+    RelocatableHandle::moves = 0;
+
+    auto vec = EA::RelocatingVector<RelocatableHandle>();
+
+    for (int index = 0; index < 1000; ++index)
+        vec.create(index);
+
+    vec.insertAt(0, -1);
+    vec.removeAt(500);
+    vec.eraseIf([](const RelocatableHandle& handle) { return handle.value < 10; });
+
+    check(vec.size() == 989);
+    check(vec[0].value == 10);
+    check(vec.back().value == 999);
+    check(RelocatableHandle::moves == 0);
+};
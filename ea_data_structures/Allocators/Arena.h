@@ -0,0 +1,170 @@
+#pragma once
+
+#include "../Structures/Vector.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace EA::Allocators
+{
+//A monotonic (bump pointer) memory_resource for scratch memory.
+//Allocating just moves a pointer forward inside the current chunk, and
+//deallocate() does nothing: memory is given back all at once with
+//rewindTo(mark()) or reset(). When a chunk is full a bigger one is chained
+//after it. Chunks are kept after rewinding, so a per-block or per-request
+//pattern of mark/allocate/rewind stops allocating after the first few rounds.
+//
+//Works anywhere a std::pmr::memory_resource does, e.g. PMR::Object,
+//PMR::Vector and PMR::makeShared. Objects in rewound memory aren't destroyed,
+//so only rewind past objects that have already been destroyed (or are
+//trivially destructible). Not thread safe.
+class Arena final : public std::pmr::memory_resource
+{
+public:
+    //A position in the arena to rewind to later
+    struct Marker
+    {
+        int chunk = 0;
+        size_t offset = 0;
+    };
+
+    explicit Arena(
+        size_t initialChunkSize = 64 * 1024,
+        std::pmr::memory_resource* upstreamToUse = std::pmr::new_delete_resource())
+        : upstream(upstreamToUse)
+    {
+        addChunk(std::max(initialChunkSize, (size_t) 64), 0);
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() override
+    {
+        for (auto& chunk: chunks)
+            upstream->deallocate(chunk.data, chunk.size, chunkAlignment);
+    }
+
+    Marker mark() const noexcept { return {current, offset}; }
+
+    //Frees everything allocated after the marker was taken
+    void rewindTo(const Marker& marker) noexcept
+    {
+        current = marker.chunk;
+        offset = marker.offset;
+    }
+
+    //Frees everything, keeping the chunks for reuse
+    void reset() noexcept { rewindTo({}); }
+
+    //Bytes handed out since the start (including alignment padding and the
+    //unused ends of full chunks)
+    size_t getBytesUsed() const noexcept
+    {
+        auto used = offset;
+
+        for (int index = 0; index < current; ++index)
+            used += chunks[index].size;
+
+        return used;
+    }
+
+    size_t getCapacity() const noexcept
+    {
+        auto capacity = (size_t) 0;
+
+        for (auto& chunk: chunks)
+            capacity += chunk.size;
+
+        return capacity;
+    }
+
+    int getNumChunks() const noexcept { return chunks.size(); }
+
+private:
+    struct Chunk
+    {
+        std::byte* data = nullptr;
+        size_t size = 0;
+    };
+
+    static constexpr size_t chunkAlignment = alignof(std::max_align_t);
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        if (auto* result = allocateFromChunk(bytes, alignment))
+            return result;
+
+        //Move on to the next chunk that can hold the request, or chain a new
+        //one, twice as big as the last, right after the current chunk
+        auto needed = bytes + alignment;
+
+        if (current + 1 < chunks.size() && chunks[current + 1].size >= needed)
+            ++current;
+        else
+        {
+            auto size = std::max(needed, chunks[current].size * 2);
+            addChunk(size, current + 1);
+            ++current;
+        }
+
+        offset = 0;
+        return allocateFromChunk(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return &other == this;
+    }
+
+    void* allocateFromChunk(size_t bytes, size_t alignment) noexcept
+    {
+        auto& chunk = chunks[current];
+        auto address = reinterpret_cast<std::uintptr_t>(chunk.data) + offset;
+        auto padding = (alignment - address % alignment) % alignment;
+
+        if (offset + padding + bytes > chunk.size)
+            return nullptr;
+
+        auto* result = chunk.data + offset + padding;
+        offset += padding + bytes;
+
+        return result;
+    }
+
+    void addChunk(size_t size, int position)
+    {
+        auto* data = upstream->allocate(size, chunkAlignment);
+        chunks.insert(position, {static_cast<std::byte*>(data), size});
+    }
+
+    std::pmr::memory_resource* upstream;
+    Vector<Chunk> chunks;
+    int current = 0;
+    size_t offset = 0;
+};
+
+//Takes a marker on construction and rewinds the arena to it when it goes out
+//of scope, so everything allocated inside the scope is freed together
+class ArenaScope
+{
+public:
+    explicit ArenaScope(Arena& arenaToUse)
+        : arena(arenaToUse)
+        , marker(arenaToUse.mark())
+    {
+    }
+
+    ~ArenaScope() { arena.rewindTo(marker); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena& arena;
+    Arena::Marker marker;
+};
+} // namespace EA::Allocators
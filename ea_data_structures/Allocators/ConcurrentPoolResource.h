@@ -0,0 +1,252 @@
+#pragma once
+
+#include "MultiPoolAllocator.h"
+#include "../Flags/Locks.h"
+
+namespace EA::Allocators
+{
+struct ConcurrentPoolOptions : MultiPoolOptions
+{
+    //How many blocks move between a thread's cache and the shared depot at once
+    int magazineSize = 32;
+};
+
+namespace Detail
+{
+//The state shared by all threads using a ConcurrentPoolResource: one
+//spinlocked MemoryPool per size class. Threads only come here in batches of
+//magazineSize blocks, to refill an empty cache or to flush a full one.
+//Owned by the resource alone. Thread caches only keep a weak_ptr to it.
+class ConcurrentPoolDepot
+{
+public:
+    ConcurrentPoolDepot(const ConcurrentPoolOptions& options,
+                        std::pmr::memory_resource* upstreamToUse)
+        : classes(options)
+        , magazineSize(std::max(1, options.magazineSize))
+        , upstream(upstreamToUse)
+        , sizeClasses(new SizeClass[(size_t) classes.getNumClasses()])
+    {
+    }
+
+    void refill(int classIndex, Vector<void*>& magazine)
+    {
+        auto& sizeClass = sizeClasses[(size_t) classIndex];
+        auto lock = Locks::ScopedSpinLock(sizeClass.lock);
+
+        if (sizeClass.pool == nullptr)
+            sizeClass.pool = classes.createPool(classIndex, upstream);
+
+        auto blockSize = classes.getBlockSize(classIndex);
+
+        for (int index = 0; index < magazineSize; ++index)
+            magazine.add(sizeClass.pool->allocate(blockSize));
+    }
+
+    //Returns the last numBlocks blocks of the magazine. After release() they
+    //are just dropped.
+    void flush(int classIndex, Vector<void*>& magazine, int numBlocks)
+    {
+        auto& sizeClass = sizeClasses[(size_t) classIndex];
+        auto lock = Locks::ScopedSpinLock(sizeClass.lock);
+        auto blockSize = classes.getBlockSize(classIndex);
+
+        for (int index = 0; index < numBlocks; ++index)
+        {
+            if (sizeClass.pool != nullptr)
+                sizeClass.pool->deallocate(magazine.back(), blockSize);
+
+            magazine.pop_back();
+        }
+    }
+
+    //Gives all slabs back to upstream, including blocks still in use
+    void release()
+    {
+        for (int index = 0; index < classes.getNumClasses(); ++index)
+        {
+            auto& sizeClass = sizeClasses[(size_t) index];
+            auto lock = Locks::ScopedSpinLock(sizeClass.lock);
+            sizeClass.pool.reset();
+        }
+    }
+
+    const SizeClasses classes;
+    const int magazineSize;
+    std::pmr::memory_resource* const upstream;
+
+private:
+    struct SizeClass
+    {
+        Locks::PrimitiveSpinLock lock;
+        std::unique_ptr<MemoryPool> pool;
+    };
+
+    std::unique_ptr<SizeClass[]> sizeClasses;
+};
+
+//The blocks one thread has cached, per depot and size class.
+//Depots are compared by their control block, which the weak_ptr keeps
+//alive, so a new depot can't show up as an old one.
+//Once a depot expired, the blocks cached for it point into slabs that were
+//already freed, so they're dropped without flushing.
+class ConcurrentPoolThreadCache
+{
+public:
+    struct Entry
+    {
+        std::weak_ptr<ConcurrentPoolDepot> depot;
+        Vector<Vector<void*>> magazines;
+    };
+
+    ~ConcurrentPoolThreadCache()
+    {
+        for (auto& entry: entries)
+            flushAll(entry);
+    }
+
+    Entry& get(const std::shared_ptr<ConcurrentPoolDepot>& depot)
+    {
+        if (last != nullptr && isFor(*last, depot))
+            return *last;
+
+        for (auto& entry: entries)
+        {
+            if (isFor(entry, depot))
+                return *(last = &entry);
+        }
+
+        removeOrphans();
+
+        auto& entry = entries.create();
+        entry.depot = depot;
+        entry.magazines.resize(depot->classes.getNumClasses());
+
+        for (auto& magazine: entry.magazines)
+            magazine.reserve(depot->magazineSize * 2);
+
+        return *(last = &entry);
+    }
+
+    static ConcurrentPoolThreadCache& getForThisThread()
+    {
+        thread_local auto cache = ConcurrentPoolThreadCache();
+        return cache;
+    }
+
+private:
+    static bool isFor(const Entry& entry,
+                      const std::shared_ptr<ConcurrentPoolDepot>& depot)
+    {
+        return !entry.depot.owner_before(depot) && !depot.owner_before(entry.depot);
+    }
+
+    static void flushAll(Entry& entry)
+    {
+        auto depot = entry.depot.lock();
+
+        if (depot == nullptr)
+            return;
+
+        for (int index = 0; index < entry.magazines.size(); ++index)
+        {
+            auto& magazine = entry.magazines[index];
+            depot->flush(index, magazine, magazine.size());
+        }
+    }
+
+    static bool isOrphan(const Entry& entry) { return entry.depot.expired(); }
+
+    //Drops the caches of resources that are gone
+    void removeOrphans()
+    {
+        entries.eraseIf(isOrphan);
+        last = nullptr;
+    }
+
+    Vector<Entry> entries;
+    Entry* last = nullptr;
+};
+} // namespace Detail
+
+//A thread safe pool memory_resource for many threads allocating at once.
+//Uses the same power-of-two size classes as MultiPoolResource, but every
+//thread keeps its own cache ("magazine") of free blocks per size class.
+//Allocating and freeing only touch that cache, without locks or atomics.
+//When a cache runs empty it takes magazineSize blocks from the shared depot,
+//and when it holds twice that many it gives magazineSize back, each under a
+//short per-class spinlock.
+//Blocks can be freed on any thread. Oversized requests go to upstream,
+//which has to be thread safe as well (the default one is).
+//Like std::pmr::synchronized_pool_resource, destroying the resource gives
+//all its slabs back to upstream right away, even blocks other threads still
+//have cached.
+class ConcurrentPoolResource final : public std::pmr::memory_resource
+{
+public:
+    using Options = ConcurrentPoolOptions;
+
+    explicit ConcurrentPoolResource(
+        const Options& options = {},
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : depot(std::make_shared<Detail::ConcurrentPoolDepot>(options, upstream))
+    {
+    }
+
+    //A thread that is exiting may be flushing into the depot and keep it
+    //alive a little longer, so the slabs are released here, while upstream
+    //is surely still around
+    ~ConcurrentPoolResource() override { depot->release(); }
+
+    ConcurrentPoolResource(const ConcurrentPoolResource&) = delete;
+    ConcurrentPoolResource& operator=(const ConcurrentPoolResource&) = delete;
+
+private:
+    using ThreadCache = Detail::ConcurrentPoolThreadCache;
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        if (!depot->classes.isPooled(bytes, alignment))
+            return depot->upstream->allocate(bytes, alignment);
+
+        auto classIndex = depot->classes.getClassIndex(bytes);
+        auto& magazine = getMagazine(classIndex);
+
+        if (magazine.empty())
+            depot->refill(classIndex, magazine);
+
+        auto* block = magazine.back();
+        magazine.pop_back();
+
+        return block;
+    }
+
+    void do_deallocate(void* data, size_t bytes, size_t alignment) override
+    {
+        if (!depot->classes.isPooled(bytes, alignment))
+        {
+            depot->upstream->deallocate(data, bytes, alignment);
+            return;
+        }
+
+        auto classIndex = depot->classes.getClassIndex(bytes);
+        auto& magazine = getMagazine(classIndex);
+        magazine.add(data);
+
+        if (magazine.size() >= depot->magazineSize * 2)
+            depot->flush(classIndex, magazine, depot->magazineSize);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return &other == this;
+    }
+
+    Vector<void*>& getMagazine(int classIndex)
+    {
+        return ThreadCache::getForThisThread().get(depot).magazines[classIndex];
+    }
+
+    std::shared_ptr<Detail::ConcurrentPoolDepot> depot;
+};
+} // namespace EA::Allocators
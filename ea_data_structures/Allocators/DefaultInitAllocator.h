@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EA::Allocators::DefaultInit
+{
+//Empty base class to allow checking for the allocator
+struct Base
+{
+};
+
+//An STL-compatible allocator adaptor that default-initializes where the
+//container would value-initialize: resize() and the size constructor leave
+//trivial types (float, int, POD structs) uninitialized instead of zeroing
+//them, for buffers that get overwritten right away. Other construction is
+//forwarded to BaseAllocator.
+template <typename T, typename BaseAllocator = std::allocator<T>>
+struct Allocator
+    : BaseAllocator
+    , Base
+{
+    using Traits = std::allocator_traits<BaseAllocator>;
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = Allocator<U, typename Traits::template rebind_alloc<U>>;
+    };
+
+    Allocator() = default;
+
+    template <typename U, typename OtherBase>
+    Allocator(const Allocator<U, OtherBase>& other) noexcept
+        : BaseAllocator(static_cast<const OtherBase&>(other))
+    {
+    }
+
+    template <typename U>
+    void construct(U* pointer) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new ((void*) pointer) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* pointer, Args&&... args)
+    {
+        auto& base = static_cast<BaseAllocator&>(*this);
+        Traits::construct(base, pointer, std::forward<Args>(args)...);
+    }
+};
+} // namespace EA::Allocators::DefaultInit
+
+namespace EA::Allocators
+{
+template <typename A>
+constexpr bool isDefaultInit()
+{
+    return std::is_base_of_v<DefaultInit::Base, A>;
+}
+} // namespace EA::Allocators
@@ -2,139 +2,340 @@
 
 #include <algorithm>
 #include "../Structures/Vector.h"
-#include <iostream>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
 
 namespace EA::Allocators
 {
-class DynamicMemory
+//A pool of fixed size blocks, carved out of large slabs.
+//Free blocks are kept in an intrusive singly linked list (the link lives inside
+//the free block itself), so allocate() and deallocate() are both O(1) and
+//don't touch the heap once enough slabs exist.
+//Requests bigger than the block size (or more aligned than max_align_t) are
+//passed on to the upstream resource, so deallocate() needs the size to tell
+//them apart.
+//Not thread safe.
+class MemoryPool
 {
 public:
-    DynamicMemory(size_t size) { data.reserve(size); }
+    //objectsPerSlab blocks are allocated up front, and whenever the pool runs
+    //out it grows by another slab of the same size. numReservedObjects sizes
+    //the slab bookkeeping so growing up to that many blocks doesn't reallocate.
+    //Slabs and oversized requests come from upstream.
+    MemoryPool(int poolObjectSizeToUse,
+               int objectsPerSlabToUse = 1000,
+               int numReservedObjects = 10000,
+               std::pmr::memory_resource* upstreamToUse =
+                   std::pmr::new_delete_resource())
+        : poolObjectSize(getBlockSize((size_t) poolObjectSizeToUse))
+        , objectsPerSlab(std::max(1, objectsPerSlabToUse))
+        , upstream(upstreamToUse)
+    {
+        slabs.reserve(numReservedObjects / objectsPerSlab + 1);
+        addSlab();
+    }
 
-    void* allocate(size_t size)
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    ~MemoryPool()
     {
-        data.resize(size);
-        return data.data();
+        for (auto* slab: slabs)
+            upstream->deallocate(slab, getSlabSize(), blockAlignment);
     }
 
-    bool operator==(const void* other) const { return getAddr() == other; }
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        if (!isPooled(size, alignment))
+            return upstream->allocate(size, alignment);
 
-private:
-    const void* getAddr() const { return data.data(); }
+        if (freeList == nullptr)
+            addSlab();
 
-    std::vector<std::byte> data;
-};
+        auto* block = freeList;
+        freeList = block->next;
 
-using SingleResource = std::unique_ptr<DynamicMemory>;
+        return block;
+    }
 
-struct ResourceContainer
-{
-    ResourceContainer(size_t sizeToReserve) { resources.reserve(sizeToReserve); }
+    void deallocate(void* data,
+                    size_t size,
+                    size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        if (data == nullptr)
+            return;
+
+        if (!isPooled(size, alignment))
+        {
+            upstream->deallocate(data, size, alignment);
+            return;
+        }
 
-    void push_back(SingleResource&& resourceToUse)
+        auto* block = static_cast<FreeBlock*>(data);
+        block->next = freeList;
+        freeList = block;
+    }
+
+    size_t getObjectSize() const noexcept { return poolObjectSize; }
+
+    //True when the next pooled allocate() won't need a new slab
+    bool hasFreeBlocks() const noexcept { return freeList != nullptr; }
+
+    //Total number of pooled blocks, free or in use
+    int getCapacity() const noexcept { return slabs.size() * objectsPerSlab; }
+
+private:
+    struct FreeBlock
     {
-        resources.emplace_back(std::move(resourceToUse));
+        FreeBlock* next;
+    };
+
+    static constexpr size_t blockAlignment = alignof(std::max_align_t);
+
+    static size_t getBlockSize(size_t size)
+    {
+        size = std::max(size, sizeof(FreeBlock));
+        return (size + blockAlignment - 1) / blockAlignment * blockAlignment;
     }
 
-    SingleResource pop_back() { return pop(resources.size() - 1); }
+    size_t getSlabSize() const noexcept
+    {
+        return poolObjectSize * (size_t) objectsPerSlab;
+    }
 
-    SingleResource pop(size_t index)
+    bool isPooled(size_t size, size_t alignment) const noexcept
     {
-        auto obj = std::move(resources[index]);
-        resources.erase(resources.begin() + (int) index);
-        return obj;
+        return size <= poolObjectSize && alignment <= blockAlignment;
     }
 
-    SingleResource findAndPop(const void* data)
+    //Threads every block of the new slab onto the free list
+    void addSlab()
     {
-        for (size_t index = 0; index < resources.size(); ++index)
+        auto* slab = static_cast<std::byte*>(
+            upstream->allocate(getSlabSize(), blockAlignment));
+        slabs.add(slab);
+
+        for (int index = objectsPerSlab - 1; index >= 0; --index)
         {
-            if (*resources[index] == data)
-                return pop(index);
+            auto* address = slab + (size_t) index * poolObjectSize;
+            auto* block = new (address) FreeBlock;
+            block->next = freeList;
+            freeList = block;
         }
+    }
 
-        throw std::runtime_error("Trying to deallocate a non-existing memory");
-        return nullptr;
+    size_t poolObjectSize = 0;
+    int objectsPerSlab = 0;
+    std::pmr::memory_resource* upstream;
+    FreeBlock* freeList = nullptr;
+    Vector<std::byte*> slabs;
+};
+
+//A std::pmr::memory_resource adapter that routes allocations through a
+//MemoryPool. Lets you plug the pool into PMR-aware containers.
+class MemoryPoolResource final : public std::pmr::memory_resource
+{
+public:
+    MemoryPoolResource(int objectSize = 1024 * 1024,
+                       int objectsPerSlab = 1000,
+                       int reservedObjects = 10000)
+        : pool(objectSize, objectsPerSlab, reservedObjects)
+    {
     }
 
-    bool empty() const { return resources.empty(); }
-    void create(size_t size) { push_back(std::make_unique<DynamicMemory>(size)); }
+    MemoryPool& getPool() noexcept { return pool; }
 
-    std::vector<SingleResource> resources;
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        return pool.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* data, size_t bytes, size_t alignment) override
+    {
+        pool.deallocate(data, bytes, alignment);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return &other == this;
+    }
+
+    MemoryPool pool;
 };
 
-//A pool of reusable heap blocks: allocate() hands out a free block (or
-//creates one if the free list is empty) and deallocate() returns it to the
-//free list without actually freeing it. Intended for contexts where you want
-//to avoid malloc/free calls in a hot path after an initial warm-up.
-class MemoryPool
+//How often a size class of a MultiPoolResource was used: a hit was served
+//from a free block, a miss had to fetch a new slab from upstream first.
+struct SizeClassStatistics
+{
+    size_t blockSize = 0;
+    long long hits = 0;
+    long long misses = 0;
+};
+
+struct MultiPoolOptions
+{
+    int minBlockSize = 16;
+    int maxBlockSize = 4096;
+
+    //Every pool grows by a slab of roughly this many bytes
+    int slabSize = 64 * 1024;
+};
+
+namespace Detail
+{
+//Maps request sizes to power-of-two size classes, shared by the pool resources
+class SizeClasses
 {
 public:
-    MemoryPool(int poolObjectSizeToUse,
-               int freeListInitialSize = 1000,
-               int numReservedObjects = 10000)
-        : poolObjectSize((size_t) poolObjectSizeToUse)
-        , free((size_t) numReservedObjects)
-        , used((size_t) numReservedObjects)
+    explicit SizeClasses(const MultiPoolOptions& optionsToUse)
+        : options(getValidOptions(optionsToUse))
     {
-        for (int index = 0; index < freeListInitialSize; ++index)
-            free.create(poolObjectSize);
     }
 
-    void* allocate(size_t size)
+    int getNumClasses() const noexcept
     {
-        if (free.empty())
-            free.create(std::max(size, poolObjectSize));
+        return getClassIndex((size_t) options.maxBlockSize) + 1;
+    }
 
-        return allocateFromFreePool(size);
+    bool isPooled(size_t bytes, size_t alignment) const noexcept
+    {
+        return bytes <= (size_t) options.maxBlockSize
+               && alignment <= alignof(std::max_align_t);
     }
 
-    void deallocate(const void* data)
+    int getClassIndex(size_t bytes) const noexcept
     {
-        if (auto u = used.findAndPop(data))
-            free.push_back(std::move(u));
+        auto size = std::max(bytes, (size_t) options.minBlockSize);
+        auto minShift = std::countr_zero((unsigned) options.minBlockSize);
+
+        return (int) std::bit_width(size - 1) - minShift;
     }
 
-private:
-    void* allocateFromFreePool(size_t size)
+    size_t getBlockSize(int classIndex) const noexcept
+    {
+        return (size_t) options.minBlockSize << classIndex;
+    }
+
+    std::unique_ptr<MemoryPool> createPool(int classIndex,
+                                           std::pmr::memory_resource* upstream) const
     {
-        auto last = free.pop_back();
-        auto addr = last->allocate(size);
-        used.push_back(std::move(last));
+        auto blockSize = (int) getBlockSize(classIndex);
+        auto objectsPerSlab = std::max(1, options.slabSize / blockSize);
 
-        return addr;
+        return std::make_unique<MemoryPool>(
+            blockSize, objectsPerSlab, objectsPerSlab, upstream);
     }
 
-    void addFreeObject() { free.create(poolObjectSize); }
+private:
+    static MultiPoolOptions getValidOptions(MultiPoolOptions result)
+    {
+        auto minSize = std::max(result.minBlockSize, (int) sizeof(void*));
+        result.minBlockSize = (int) std::bit_ceil((unsigned) minSize);
 
-    size_t poolObjectSize = 0;
-    ResourceContainer free;
-    ResourceContainer used;
+        auto maxSize = std::max(result.maxBlockSize, result.minBlockSize);
+        result.maxBlockSize = (int) std::bit_ceil((unsigned) maxSize);
+
+        return result;
+    }
+
+    MultiPoolOptions options;
 };
+} // namespace Detail
 
-//A std::pmr::memory_resource adapter that routes allocations through a
-//MemoryPool. Lets you plug the pool into PMR-aware containers.
-class MemoryPoolResource final : public std::pmr::memory_resource
+//A std::pmr::memory_resource with power-of-two size classes, from
+//minBlockSize up to maxBlockSize, each backed by its own MemoryPool.
+//A request is rounded up to the nearest class, so the most a block wastes is
+//just under half its size. Bigger (or over-aligned) requests go straight to
+//the upstream resource, which also provides the slabs.
+//Pools are created the first time their size class is used. Not thread safe.
+class MultiPoolResource final : public std::pmr::memory_resource
 {
 public:
-    MemoryPoolResource(int objectSize = 1024 * 1024,
-                       int freeListInitial = 1000,
-                       int reservedObjects = 10000)
-        : pool(objectSize, freeListInitial, reservedObjects)
+    using Options = MultiPoolOptions;
+
+    explicit MultiPoolResource(
+        const Options& options = {},
+        std::pmr::memory_resource* upstreamToUse = std::pmr::new_delete_resource())
+        : classes(options)
+        , upstream(upstreamToUse)
+    {
+        auto numClasses = classes.getNumClasses();
+        pools.resize(numClasses);
+        statistics.resize(numClasses);
+
+        for (int index = 0; index < numClasses; ++index)
+            statistics[index].blockSize = classes.getBlockSize(index);
+    }
+
+    MultiPoolResource(std::pmr::memory_resource* upstreamToUse)
+        : MultiPoolResource(Options(), upstreamToUse)
+    {
+    }
+
+    const Vector<SizeClassStatistics>& getStatistics() const noexcept
+    {
+        return statistics;
+    }
+
+    long long getNumUpstreamAllocations() const noexcept
     {
+        return upstreamAllocations;
     }
 
+    int getNumSizeClasses() const noexcept { return statistics.size(); }
+
+    std::pmr::memory_resource* getUpstream() const noexcept { return upstream; }
+
 private:
-    void* do_allocate(size_t bytes, size_t) override { return pool.allocate(bytes); }
-    void do_deallocate(void* data, size_t, size_t) override
+    void* do_allocate(size_t bytes, size_t alignment) override
     {
-        pool.deallocate(data);
+        if (!classes.isPooled(bytes, alignment))
+        {
+            ++upstreamAllocations;
+            return upstream->allocate(bytes, alignment);
+        }
+
+        auto classIndex = classes.getClassIndex(bytes);
+        auto& pool = pools[classIndex];
+        auto& stats = statistics[classIndex];
+
+        if (pool != nullptr && pool->hasFreeBlocks())
+            ++stats.hits;
+        else
+        {
+            ++stats.misses;
+
+            if (pool == nullptr)
+                pool = classes.createPool(classIndex, upstream);
+        }
+
+        return pool->allocate(bytes, alignment);
     }
+
+    void do_deallocate(void* data, size_t bytes, size_t alignment) override
+    {
+        if (!classes.isPooled(bytes, alignment))
+        {
+            upstream->deallocate(data, bytes, alignment);
+            return;
+        }
+
+        pools[classes.getClassIndex(bytes)]->deallocate(data, bytes, alignment);
+    }
+
     bool do_is_equal(const memory_resource& other) const noexcept override
     {
         return &other == this;
     }
 
-    MemoryPool pool;
+    Detail::SizeClasses classes;
+    std::pmr::memory_resource* upstream;
+    Vector<std::unique_ptr<MemoryPool>> pools;
+    Vector<SizeClassStatistics> statistics;
+    long long upstreamAllocations = 0;
 };
 } // namespace EA::Allocators
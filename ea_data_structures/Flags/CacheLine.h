@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+namespace EA
+{
+//The size to pad to when two threads must not write to the same cache line.
+//std::hardware_destructive_interference_size isn't available everywhere (and
+//GCC warns when it's used in headers), so it's spelled out here instead.
+//Apple Silicon uses 128 byte lines.
+#if defined(__APPLE__) && (defined(__aarch64__) || defined(__arm64__))
+constexpr int cacheLineSize = 128;
+#else
+constexpr int cacheLineSize = 64;
+#endif
+
+//Holds a value followed by enough padding to fill the rest of its cache
+//line(s), so two CacheLinePadded members next to each other never share one.
+//Padding is done by hand rather than with alignas, which MSVC warns about.
+template <typename T>
+struct CacheLinePadded
+{
+    T value {};
+
+private:
+    static constexpr auto usedBytes = sizeof(T) % (size_t) cacheLineSize;
+    char padding[(size_t) cacheLineSize - usedBytes] {};
+};
+} // namespace EA
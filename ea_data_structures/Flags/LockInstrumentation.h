@@ -0,0 +1,270 @@
+#pragma once
+
+#include "CopyableAtomic.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+//Opt-in contention counters for the spinlocks, to find the locks worth
+//replacing. Enable with the EA_LOCK_INSTRUMENTATION CMake option (or by
+//defining EA_LOCK_INSTRUMENTATION=1 for every file of the program).
+//When it's off, the instrumented locks have the same size and code as
+//without it.
+#if !defined(EA_LOCK_INSTRUMENTATION)
+    #define EA_LOCK_INSTRUMENTATION 0
+#endif
+
+#if EA_LOCK_INSTRUMENTATION
+    #include <algorithm>
+    #include <mutex>
+    #include <sstream>
+    #include <vector>
+#endif
+
+namespace EA::Locks
+{
+//What one lock (or every destroyed lock with the same name) went through
+struct LockStats
+{
+    std::string name;
+    std::uint64_t acquisitions = 0;
+    std::uint64_t contendedAcquisitions = 0;
+    std::uint64_t spins = 0;
+    std::uint64_t waitNanoseconds = 0;
+};
+
+#if EA_LOCK_INSTRUMENTATION
+
+class InstrumentedLock;
+
+//Every live instrumented lock, plus the totals of destroyed ones by name
+class LockRegistry
+{
+public:
+    static LockRegistry& get()
+    {
+        static auto registry = LockRegistry();
+        return registry;
+    }
+
+    void add(InstrumentedLock& lock)
+    {
+        auto guard = std::lock_guard(mutex);
+        locks.push_back(&lock);
+    }
+
+    inline void remove(InstrumentedLock& lock);
+
+    //All locks that were ever taken, most time spent waiting first
+    inline std::vector<LockStats> getStats() const;
+
+    //A table of getStats(), one lock per line
+    std::string getReport() const
+    {
+        auto stream = std::ostringstream();
+        stream << "lock, acquisitions, contended, spins, wait ms\n";
+
+        for (auto& stats: getStats())
+        {
+            stream << stats.name << ", " << stats.acquisitions << ", "
+                   << stats.contendedAcquisitions << ", " << stats.spins << ", "
+                   << (double) stats.waitNanoseconds / 1e6 << "\n";
+        }
+
+        return stream.str();
+    }
+
+    //Forgets destroyed locks and zeroes the live ones
+    inline void reset();
+
+private:
+    static void merge(std::vector<LockStats>& list, const LockStats& stats)
+    {
+        for (auto& existing: list)
+        {
+            if (existing.name == stats.name)
+            {
+                existing.acquisitions += stats.acquisitions;
+                existing.contendedAcquisitions += stats.contendedAcquisitions;
+                existing.spins += stats.spins;
+                existing.waitNanoseconds += stats.waitNanoseconds;
+                return;
+            }
+        }
+
+        list.push_back(stats);
+    }
+
+    mutable std::mutex mutex;
+    std::vector<InstrumentedLock*> locks;
+    std::vector<LockStats> destroyed;
+};
+
+//The base of the instrumented locks. The counters are only written while
+//the lock is held, so they're plain loads and stores, never atomic RMWs.
+class InstrumentedLock
+{
+public:
+    InstrumentedLock() { LockRegistry::get().add(*this); }
+
+    InstrumentedLock(const InstrumentedLock&) = delete;
+    InstrumentedLock& operator=(const InstrumentedLock&) = delete;
+
+    ~InstrumentedLock() { LockRegistry::get().remove(*this); }
+
+    //Shown in the report. Has to outlive the lock (e.g. a string literal).
+    void setLockName(const char* nameToUse) noexcept { name = nameToUse; }
+
+    LockStats getLockStats() const
+    {
+        auto stats = LockStats();
+        stats.name = name;
+        stats.acquisitions = acquisitions.load(std::memory_order_relaxed);
+        stats.contendedAcquisitions = contended.load(std::memory_order_relaxed);
+        stats.spins = spins.load(std::memory_order_relaxed);
+        stats.waitNanoseconds = waitNanoseconds.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    void resetLockStats() noexcept
+    {
+        acquisitions.store(0, std::memory_order_relaxed);
+        contended.store(0, std::memory_order_relaxed);
+        spins.store(0, std::memory_order_relaxed);
+        waitNanoseconds.store(0, std::memory_order_relaxed);
+    }
+
+protected:
+    //Lives for one lock() call: counts the waiting loop's iterations, and
+    //times them if there were any
+    class Probe
+    {
+        using Clock = std::chrono::steady_clock;
+
+    public:
+        explicit Probe(InstrumentedLock& lockToUse) noexcept
+            : lock(lockToUse)
+        {
+        }
+
+        void spin() noexcept
+        {
+            if (numSpins++ == 0)
+                start = Clock::now();
+        }
+
+        //Call once the lock is held
+        void acquired() noexcept
+        {
+            auto waited = std::uint64_t(0);
+
+            if (numSpins > 0)
+            {
+                auto duration = Clock::now() - start;
+                waited = (std::uint64_t) std::chrono::duration_cast<
+                             std::chrono::nanoseconds>(duration)
+                             .count();
+            }
+
+            lock.record(numSpins, waited);
+        }
+
+    private:
+        InstrumentedLock& lock;
+        std::uint64_t numSpins = 0;
+        Clock::time_point start;
+    };
+
+private:
+    static void increase(Atomic<std::uint64_t>& counter, std::uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount,
+                      std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t numSpins, std::uint64_t waited) noexcept
+    {
+        increase(acquisitions, 1);
+
+        if (numSpins > 0)
+        {
+            increase(contended, 1);
+            increase(spins, numSpins);
+            increase(waitNanoseconds, waited);
+        }
+    }
+
+    const char* name = "unnamed";
+    Atomic<std::uint64_t> acquisitions {0};
+    Atomic<std::uint64_t> contended {0};
+    Atomic<std::uint64_t> spins {0};
+    Atomic<std::uint64_t> waitNanoseconds {0};
+};
+
+void LockRegistry::remove(InstrumentedLock& lock)
+{
+    auto stats = lock.getLockStats();
+    auto guard = std::lock_guard(mutex);
+
+    std::erase(locks, &lock);
+
+    if (stats.acquisitions > 0)
+        merge(destroyed, stats);
+}
+
+std::vector<LockStats> LockRegistry::getStats() const
+{
+    auto guard = std::lock_guard(mutex);
+    auto result = destroyed;
+
+    for (auto* lock: locks)
+    {
+        auto stats = lock->getLockStats();
+
+        if (stats.acquisitions > 0)
+            merge(result, stats);
+    }
+
+    std::sort(result.begin(),
+              result.end(),
+              [](const LockStats& first, const LockStats& second)
+              { return first.waitNanoseconds > second.waitNanoseconds; });
+
+    return result;
+}
+
+void LockRegistry::reset()
+{
+    auto guard = std::lock_guard(mutex);
+    destroyed.clear();
+
+    for (auto* lock: locks)
+        lock->resetLockStats();
+}
+
+#else
+
+//Without instrumentation: an empty base, and a Probe that compiles away
+class InstrumentedLock
+{
+public:
+    void setLockName(const char*) noexcept {}
+
+protected:
+    struct Probe
+    {
+        explicit Probe(InstrumentedLock&) noexcept {}
+
+        void spin() noexcept {}
+        void acquired() noexcept {}
+    };
+};
+
+#endif
+
+constexpr bool isLockInstrumentationEnabled()
+{
+    return EA_LOCK_INSTRUMENTATION != 0;
+}
+} // namespace EA::Locks
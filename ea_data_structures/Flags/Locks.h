@@ -2,10 +2,16 @@
 
 #include "CopyableAtomic.h"
 #include "Bool.h"
+#include "CacheLine.h"
+#include "LockInstrumentation.h"
 #include "SpinHint.h"
+#include <thread>
+#include <utility>
 
 //A primitive version of a spinlocks for simple tasks when the lock
-//Is really held for a very short period of time
+//Is really held for a very short period of time, plus fair queue locks
+//(TicketLock, MCSLock) for when many threads fight over one, and
+//SpinThenBlockLock for critical sections that can take a while
 
 namespace EA::Locks
 {
@@ -23,22 +29,55 @@ private:
     Atomic<bool> atomic {false};
 };
 
-class PrimitiveSpinLock
+//Exponential backoff for spin-wait loops: each pause() spins twice as long
+//as the last, up to maxSpins spinHint()s, after which it yields the thread,
+//so a waiter whose lock holder got preempted doesn't burn its time slice.
+class Backoff
 {
 public:
-    void lock() noexcept
+    static constexpr int maxSpins = 64;
+
+    void pause() noexcept
     {
-        while (true)
+        if (spins > maxSpins)
         {
-            if (tryLock())
-                return;
+            std::this_thread::yield();
+            return;
+        }
+
+        for (int index = 0; index < spins; ++index)
+            spinHint();
+
+        spins *= 2;
+    }
+
+    void reset() noexcept { spins = 1; }
+
+private:
+    int spins = 1;
+};
+
+//Counts its contention when EA_LOCK_INSTRUMENTATION is on
+class PrimitiveSpinLock : public InstrumentedLock
+{
+public:
+    void lock() noexcept
+    {
+        auto probe = Probe(*this);
 
+        while (!tryLock())
+        {
             //Read-only spin until the lock looks free, so contending
             //cores can keep the cache line in Shared state instead of
             //ping-ponging it via repeated test_and_set writes.
-            while (locked.test())
+            do
+            {
+                probe.spin();
                 spinHint();
+            } while (locked.test());
         }
+
+        probe.acquired();
     }
 
     bool tryLock() noexcept { return !locked.test_and_set(); }
@@ -50,6 +89,316 @@ private:
     AtomicFlag locked;
 };
 
+//A fair spinlock: threads get the lock in the order they asked for it, so no
+//thread starves. lock() takes a ticket, then waits (reading only) until
+//nowServing reaches it, and unlock() serves the next ticket.
+//Waiters still all read the same cache line, so prefer MCSLock when many
+//threads contend.
+class TicketLock
+{
+public:
+    void lock() noexcept
+    {
+        auto ticket = nextTicket.value.fetch_add(1, std::memory_order_relaxed);
+        auto backoff = Backoff();
+
+        while (nowServing.value.load(std::memory_order_acquire) != ticket)
+            backoff.pause();
+    }
+
+    bool tryLock() noexcept
+    {
+        auto serving = nowServing.value.load(std::memory_order_acquire);
+        auto ticket = serving;
+
+        return nextTicket.value.compare_exchange_strong(ticket,
+                                                       serving + 1,
+                                                       std::memory_order_acquire,
+                                                       std::memory_order_relaxed);
+    }
+
+    bool isLocked() const noexcept
+    {
+        return nextTicket.value.load() != nowServing.value.load();
+    }
+
+    void unlock() noexcept
+    {
+        auto next = nowServing.value.load(std::memory_order_relaxed) + 1;
+        nowServing.value.store(next, std::memory_order_release);
+    }
+
+private:
+    CacheLinePadded<Atomic<unsigned>> nextTicket;
+    CacheLinePadded<Atomic<unsigned>> nowServing;
+};
+
+namespace Detail
+{
+//A waiter in an MCSLock queue. Each one sits on its own cache line.
+struct MCSNode
+{
+    Atomic<MCSNode*> next {nullptr};
+    Atomic<bool> waiting {false};
+    MCSNode* nextFree = nullptr;
+
+private:
+    char padding[cacheLineSize] {};
+};
+
+//The nodes of one thread, reused between lock() calls. A thread needs one
+//per MCSLock it holds at the same time.
+class MCSNodePool
+{
+public:
+    MCSNodePool() = default;
+    MCSNodePool(const MCSNodePool&) = delete;
+    MCSNodePool& operator=(const MCSNodePool&) = delete;
+
+    ~MCSNodePool()
+    {
+        while (free != nullptr)
+            delete std::exchange(free, free->nextFree);
+    }
+
+    MCSNode* acquire()
+    {
+        if (free == nullptr)
+            return new MCSNode();
+
+        return std::exchange(free, free->nextFree);
+    }
+
+    void release(MCSNode* node) noexcept
+    {
+        node->nextFree = std::exchange(free, node);
+    }
+
+    static MCSNodePool& getForThisThread()
+    {
+        thread_local auto pool = MCSNodePool();
+        return pool;
+    }
+
+private:
+    MCSNode* free = nullptr;
+};
+} // namespace Detail
+
+//A fair queue lock (Mellor-Crummey & Scott) that scales with contention:
+//waiters form a queue and each one spins on a flag in its own node, so
+//handing the lock over touches one waiter's cache line instead of all of
+//them. Nodes come from a per-thread pool, so lock() and unlock() have to be
+//called on the same thread (as with std::mutex).
+class MCSLock
+{
+    using Node = Detail::MCSNode;
+
+public:
+    void lock()
+    {
+        auto* node = Detail::MCSNodePool::getForThisThread().acquire();
+        node->next.store(nullptr, std::memory_order_relaxed);
+        node->waiting.store(true, std::memory_order_relaxed);
+
+        auto* previous = tail.value.exchange(node, std::memory_order_acq_rel);
+
+        if (previous != nullptr)
+        {
+            previous->next.store(node, std::memory_order_release);
+            auto backoff = Backoff();
+
+            while (node->waiting.load(std::memory_order_acquire))
+                backoff.pause();
+        }
+
+        holder = node;
+    }
+
+    bool tryLock()
+    {
+        auto& pool = Detail::MCSNodePool::getForThisThread();
+        auto* node = pool.acquire();
+        node->next.store(nullptr, std::memory_order_relaxed);
+
+        Node* empty = nullptr;
+
+        if (!tail.value.compare_exchange_strong(
+                empty, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            pool.release(node);
+            return false;
+        }
+
+        holder = node;
+        return true;
+    }
+
+    bool isLocked() const noexcept { return tail.value.load() != nullptr; }
+
+    void unlock() noexcept
+    {
+        auto* node = holder;
+        auto* next = node->next.load(std::memory_order_acquire);
+
+        if (next == nullptr)
+        {
+            auto* expected = node;
+
+            if (tail.value.compare_exchange_strong(expected,
+                                                   nullptr,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed))
+            {
+                Detail::MCSNodePool::getForThisThread().release(node);
+                return;
+            }
+
+            //A waiter swapped itself in, but hasn't linked to us yet
+            while ((next = node->next.load(std::memory_order_acquire)) == nullptr)
+                spinHint();
+        }
+
+        next->waiting.store(false, std::memory_order_release);
+        Detail::MCSNodePool::getForThisThread().release(node);
+    }
+
+private:
+    CacheLinePadded<Atomic<Node*>> tail;
+    Node* holder = nullptr;
+};
+
+//A lock for critical sections that are usually short but sometimes aren't.
+//lock() spins with backoff for a while, then sleeps in the OS until
+//unlock() wakes it (atomic wait/notify, a futex on Linux), instead of
+//burning a core. Where atomic wait isn't available it yields instead.
+//State is 0 when free, 1 when locked, and 2 when locked with sleepers.
+class SpinThenBlockLock
+{
+public:
+    static constexpr int spinsBeforeBlocking = 100;
+
+    void lock() noexcept
+    {
+        auto backoff = Backoff();
+
+        for (int attempt = 0; attempt < spinsBeforeBlocking; ++attempt)
+        {
+            if (tryLock())
+                return;
+
+            backoff.pause();
+        }
+
+        while (state.exchange(2, std::memory_order_acquire) != 0)
+            waitWhileLocked();
+    }
+
+    bool tryLock() noexcept
+    {
+        auto expected = 0;
+        return state.compare_exchange_strong(
+            expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    bool isLocked() const noexcept { return state.load() != 0; }
+
+    void unlock() noexcept
+    {
+        if (state.exchange(0, std::memory_order_release) == 2)
+            wakeOne();
+    }
+
+private:
+    void waitWhileLocked() noexcept
+    {
+#if defined(__cpp_lib_atomic_wait)
+        state.wait(2, std::memory_order_relaxed);
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    void wakeOne() noexcept
+    {
+#if defined(__cpp_lib_atomic_wait)
+        state.notify_one();
+#endif
+    }
+
+    Atomic<int> state {0};
+};
+
+//A reader-writer spinlock for data that's read a lot and written rarely:
+//any number of readers can hold it at once (lockShared/unlockShared), a
+//writer holds it alone (lock/unlock).
+//Writers take precedence: once one is waiting, new readers wait too, so a
+//steady stream of readers can't starve it.
+class ReadWriteSpinLock
+{
+public:
+    void lock() noexcept
+    {
+        waitingWriters.value.fetch_add(1);
+        auto backoff = Backoff();
+
+        while (!tryLock())
+            backoff.pause();
+
+        waitingWriters.value.fetch_sub(1);
+    }
+
+    bool tryLock() noexcept
+    {
+        auto expected = 0u;
+        return state.value.compare_exchange_strong(expected,
+                                                   writerBit,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept { state.value.store(0, std::memory_order_release); }
+
+    void lockShared() noexcept
+    {
+        auto backoff = Backoff();
+
+        while (!tryLockShared())
+            backoff.pause();
+    }
+
+    bool tryLockShared() noexcept
+    {
+        if (waitingWriters.value.load() != 0)
+            return false;
+
+        auto current = state.value.load(std::memory_order_relaxed);
+
+        if ((current & writerBit) != 0)
+            return false;
+
+        return state.value.compare_exchange_weak(current,
+                                                 current + readerIncrement,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed);
+    }
+
+    void unlockShared() noexcept
+    {
+        state.value.fetch_sub(readerIncrement, std::memory_order_release);
+    }
+
+    bool isLocked() const noexcept { return state.value.load() != 0; }
+    int getNumReaders() const noexcept { return (int) (state.value.load() >> 1); }
+
+private:
+    static constexpr unsigned writerBit = 1;
+    static constexpr unsigned readerIncrement = 2;
+
+    CacheLinePadded<Atomic<unsigned>> state;
+    CacheLinePadded<Atomic<int>> waitingWriters;
+};
+
 //RAII guard for any lock with lock()/unlock() members (e.g. PrimitiveSpinLock
 //or RecursiveSpinLock). Acquires on construction, releases on destruction.
 template<typename LockType>
@@ -68,4 +417,22 @@ private:
     LockType& lock;
 };
 
+//RAII guard for the reader side of a lock with lockShared()/unlockShared()
+//members, such as ReadWriteSpinLock
+template <typename LockType>
+class ScopedSharedSpinLock
+{
+public:
+    explicit ScopedSharedSpinLock(LockType& lockToUse)
+        : lock(lockToUse)
+    {
+        lock.lockShared();
+    }
+
+    ~ScopedSharedSpinLock() { lock.unlockShared(); }
+
+private:
+    LockType& lock;
+};
+
 } // namespace EA::Locks
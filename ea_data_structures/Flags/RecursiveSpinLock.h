@@ -1,14 +1,16 @@
 #pragma once
 
 #include "CopyableAtomic.h"
+#include "Locks.h"
 #include <thread>
 
 namespace EA::Locks
 {
 //A reentrant spinlock: the owning thread can lock() multiple times without
 //deadlocking (tracked via std::thread::id plus a hold count). Other threads
-//busy-wait until the owning thread has released every held level.
-class RecursiveSpinLock
+//busy-wait (with backoff) until the owning thread has released every held
+//level. Counts its contention when EA_LOCK_INSTRUMENTATION is on.
+class RecursiveSpinLock : public InstrumentedLock
 {
     using ID = std::thread::id;
 
@@ -18,7 +20,24 @@ public:
         auto current = getCurrentID();
 
         if (id.load() != current)
-            while (!tryLock(current)) {}
+        {
+            auto probe = Probe(*this);
+            auto backoff = Backoff();
+
+            while (!tryLock(current))
+            {
+                probe.spin();
+
+                //Wait reading only, so the owner's cache line isn't stolen
+                while (id.load(std::memory_order_relaxed) != ID())
+                {
+                    probe.spin();
+                    backoff.pause();
+                }
+            }
+
+            probe.acquired();
+        }
 
         ++holders;
     }
@@ -28,7 +47,7 @@ public:
         --holders;
 
         if (holders == 0)
-            id.store({});
+            id.store({}, std::memory_order_release);
     }
 
 private:
@@ -36,7 +55,7 @@ private:
     {
         auto null = ID();
         return id.compare_exchange_weak(
-            null, current, std::memory_order::release, std::memory_order::relaxed);
+            null, current, std::memory_order::acquire, std::memory_order::relaxed);
     }
 
     static ID getCurrentID() noexcept { return std::this_thread::get_id(); }
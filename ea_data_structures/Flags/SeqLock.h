@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Locks.h"
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace EA::Locks
+{
+/*
+ * A sequence lock around a small, trivially copyable T (a parameter block,
+ * a transport position...), for data read far more often than it's written.
+ *
+ * load() never writes to shared memory, so readers don't slow each other or
+ * the writer down: it reads the sequence counter, copies T, and tries again
+ * if a store() happened in between (the counter is odd during a store, and
+ * changes after it). Readers can't block a writer, but a writer that stores
+ * non-stop can keep a reader retrying; tryLoad() makes a single attempt, for
+ * the realtime thread.
+ *
+ * Writers take turns on a spinlock. T is stored in atomic words, so the
+ * racing copies are well defined (and compile to plain moves on x86).
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SeqLock needs a trivially copyable type");
+
+public:
+    explicit SeqLock(const T& initialValue = {}) { write(initialValue); }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    T load() const noexcept
+    {
+        auto value = T();
+
+        while (!tryLoad(value))
+            spinHint();
+
+        return value;
+    }
+
+    //Fills value and returns true, unless a store() was in progress or
+    //happened during the read
+    bool tryLoad(T& value) const noexcept
+    {
+        auto before = sequence.value.load(std::memory_order_acquire);
+
+        if ((before & 1) != 0)
+            return false;
+
+        Word buffer[numWords];
+
+        //Acquire, so the check below can't be done before the copy
+        for (std::size_t index = 0; index < numWords; ++index)
+            buffer[index] = words[index].load(std::memory_order_acquire);
+
+        if (sequence.value.load(std::memory_order_relaxed) != before)
+            return false;
+
+        std::memcpy(&value, buffer, sizeof(T));
+        return true;
+    }
+
+    void store(const T& value) noexcept
+    {
+        auto lock = ScopedSpinLock(writeLock);
+        write(value);
+    }
+
+    //Changes the current value with func(T&), as one store
+    template <typename Func>
+    void modify(Func&& func)
+    {
+        auto lock = ScopedSpinLock(writeLock);
+        auto value = read();
+
+        func(value);
+        write(value);
+    }
+
+private:
+    using Word = std::size_t;
+    static constexpr std::size_t numWords =
+        (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    //Only while holding writeLock: no store can be in progress
+    T read() const noexcept
+    {
+        Word buffer[numWords];
+
+        for (std::size_t index = 0; index < numWords; ++index)
+            buffer[index] = words[index].load(std::memory_order_relaxed);
+
+        auto value = T();
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    void write(const T& value) noexcept
+    {
+        Word buffer[numWords] {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        auto current = sequence.value.load(std::memory_order_relaxed);
+        sequence.value.store(current + 1, std::memory_order_relaxed);
+
+        //Release, so a reader that sees any new word also sees the odd count
+        for (std::size_t index = 0; index < numWords; ++index)
+            words[index].store(buffer[index], std::memory_order_release);
+
+        sequence.value.store(current + 2, std::memory_order_release);
+    }
+
+    CacheLinePadded<Atomic<unsigned>> sequence;
+    Atomic<Word> words[numWords];
+    PrimitiveSpinLock writeLock;
+};
+} // namespace EA::Locks
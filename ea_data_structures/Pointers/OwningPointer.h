@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../ValueWrapper/Relocation.h"
 #include <memory>
 
 namespace EA
@@ -150,6 +151,12 @@ private:
     T* object = nullptr;
 };
 
+//Just a pointer, so containers can move it with memcpy
+template <typename T>
+struct TriviallyRelocatable<OwningPointer<T>> : std::true_type
+{
+};
+
 template <typename T, typename... Args>
 OwningPointer<T> makeOwned(Args&&... args)
 {
@@ -53,4 +53,9 @@ public:
 private:
     T* object = nullptr;
 };
+
+template <typename T>
+struct TriviallyRelocatable<Ref<T>> : std::true_type
+{
+};
 } // namespace EA
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../ValueWrapper/Relocation.h"
 #include <memory>
 
 namespace EA
@@ -78,4 +79,10 @@ struct RefOrOwn
     T* object = nullptr;
     Owned owned;
 };
+
+//object never points into the RefOrOwn itself, and shared_ptr doesn't either
+template <typename T>
+struct TriviallyRelocatable<RefOrOwn<T>> : std::true_type
+{
+};
 } // namespace EA
\ No newline at end of file
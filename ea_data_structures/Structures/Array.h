@@ -3,6 +3,7 @@
 //A wrapper around std::array that uses int instead of size_t, and adds some useful helper functions
 
 #include "../Utilities/VectorUtilities.h"
+#include "../Utilities/SIMD.h"
 #include <algorithm>
 #include <array>
 #include <ranges>
@@ -91,14 +92,24 @@ public:
     template <typename A>
     void mixFrom(A& other)
     {
-        for (int index = 0; index < size(); ++index)
-            container[index] += other[index];
+        if constexpr (SIMD::ContiguousOf<A, T>)
+            SIMD::mix(data(), other.data(), size());
+        else
+        {
+            for (int index = 0; index < size(); ++index)
+                container[index] += other[index];
+        }
     }
 
     void fill(const T& value)
     {
-        for (auto& element: container)
-            element = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, size());
+        else
+        {
+            for (auto& element: container)
+                element = value;
+        }
     }
 
     template <typename A>
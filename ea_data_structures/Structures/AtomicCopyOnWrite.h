@@ -0,0 +1,263 @@
+#pragma once
+
+#include "Vector.h"
+#include "../Flags/CacheLine.h"
+#include "../Flags/CopyableAtomic.h"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace EA
+{
+namespace Detail
+{
+//Epoch based reclamation, shared by every AtomicCopyOnWrite.
+//
+//A global epoch counter only goes up. A reading thread copies it into its
+//own record while it reads ("pins" it) and clears the record when done, so
+//the only thing a read writes is a cache line no other thread writes to.
+//A writer that replaces an object bumps the epoch and tags the old object
+//with the new value: once no record holds an epoch below the tag, no reader
+//can still see the old object and it can be deleted.
+class EpochDomain
+{
+public:
+    using Epoch = std::uint64_t;
+
+    static constexpr Epoch notPinned = 0;
+
+    //One per thread that has read. Records are reused by later threads, and
+    //never freed, so scanning them never races with a thread exiting.
+    struct Record
+    {
+        CacheLinePadded<Atomic<Epoch>> epoch;
+        Atomic<bool> inUse {true};
+        Record* next = nullptr;
+        int depth = 0;
+    };
+
+    static EpochDomain& get()
+    {
+        static auto domain = EpochDomain();
+        return domain;
+    }
+
+    //Nested pins on the same thread keep the outermost (oldest) epoch
+    void pin(Record& record) noexcept
+    {
+        if (record.depth++ == 0)
+            record.epoch.value.store(globalEpoch.load());
+    }
+
+    void unpin(Record& record) noexcept
+    {
+        if (--record.depth == 0)
+            record.epoch.value.store(notPinned, std::memory_order_release);
+    }
+
+    //Call after making an object unreachable: readers pinned from now on
+    //can't see it, so it can go once no record is older than the result
+    Epoch advance() noexcept { return globalEpoch.fetch_add(1) + 1; }
+
+    Epoch getOldestPinned() const noexcept
+    {
+        auto oldest = std::numeric_limits<Epoch>::max();
+
+        for (auto* record = head.load(); record != nullptr; record = record->next)
+        {
+            auto epoch = record->epoch.value.load();
+
+            if (epoch != notPinned && epoch < oldest)
+                oldest = epoch;
+        }
+
+        return oldest;
+    }
+
+    static Record& getRecordForThisThread()
+    {
+        thread_local auto handle = ThreadHandle(get().acquire());
+        return *handle.record;
+    }
+
+private:
+    struct ThreadHandle
+    {
+        explicit ThreadHandle(Record* recordToUse)
+            : record(recordToUse)
+        {
+        }
+
+        ThreadHandle(const ThreadHandle&) = delete;
+        ThreadHandle& operator=(const ThreadHandle&) = delete;
+
+        ~ThreadHandle() { record->inUse.store(false); }
+
+        Record* record;
+    };
+
+    Record* acquire()
+    {
+        for (auto* record = head.load(); record != nullptr; record = record->next)
+        {
+            auto expected = false;
+
+            if (record->inUse.compare_exchange_strong(expected, true))
+                return record;
+        }
+
+        auto* record = new Record();
+        record->next = head.load();
+
+        while (!head.compare_exchange_weak(record->next, record))
+        {
+        }
+
+        return record;
+    }
+
+    Atomic<Epoch> globalEpoch {1};
+    Atomic<Record*> head {nullptr};
+};
+} // namespace Detail
+
+/*
+ * A CopyOnWrite that can be published to and read from any number of
+ * threads at once.
+ *
+ * load() is lock free and returns a guard the current value can be read
+ * through. Unlike copying a shared_ptr, it doesn't touch a reference count
+ * shared with other readers - it only writes to its own thread's record - so
+ * many threads can read the same value without fighting over a cache line.
+ *
+ * store() and update() publish a new value. Writers take turns on a mutex.
+ * Replaced values are deleted on a later store(), update() or reclaim(), once
+ * no guard that could still see them is alive (epoch based reclamation).
+ * Keep guards short lived: a thread holding one delays deleting everything
+ * replaced after it was taken.
+ */
+template <typename T>
+class AtomicCopyOnWrite
+{
+    using Domain = Detail::EpochDomain;
+
+public:
+    //Keeps the value it was loaded with alive until it's destroyed.
+    //Has to be destroyed on the thread that created it.
+    class Guard
+    {
+    public:
+        explicit Guard(const AtomicCopyOnWrite& owner) noexcept
+            : record(Domain::getRecordForThisThread())
+        {
+            Domain::get().pin(record);
+            object = owner.current.load();
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        ~Guard() { Domain::get().unpin(record); }
+
+        const T* get() const noexcept { return object; }
+        const T& operator*() const noexcept { return *object; }
+        const T* operator->() const noexcept { return object; }
+
+    private:
+        Domain::Record& record;
+        const T* object = nullptr;
+    };
+
+    template <typename... Args>
+    explicit AtomicCopyOnWrite(Args&&... args)
+        : current(new T(std::forward<Args>(args)...))
+    {
+    }
+
+    AtomicCopyOnWrite(const AtomicCopyOnWrite&) = delete;
+    AtomicCopyOnWrite& operator=(const AtomicCopyOnWrite&) = delete;
+
+    //No guard may be alive by now
+    ~AtomicCopyOnWrite()
+    {
+        delete current.load();
+
+        for (auto& item: retired)
+            delete item.object;
+    }
+
+    Guard load() const noexcept { return Guard(*this); }
+
+    void store(const T& value) { publish(new T(value)); }
+    void store(T&& value) { publish(new T(std::move(value))); }
+
+    //Publishes a copy of the current value, changed by func(T&).
+    //Updates from different threads are applied one after the other, so
+    //none are lost.
+    template <typename Func>
+    void update(Func&& func)
+    {
+        auto lock = std::lock_guard(writeLock);
+        auto copy = std::make_unique<T>(*current.load());
+
+        func(*copy);
+        replace(copy.release());
+    }
+
+    //Deletes the replaced values no reader can see anymore.
+    //store() and update() do this as well.
+    void reclaim()
+    {
+        auto lock = std::lock_guard(writeLock);
+        reclaimRetired();
+    }
+
+    //Replaced values waiting for readers to finish
+    int getNumRetired() const
+    {
+        auto lock = std::lock_guard(writeLock);
+        return retired.size();
+    }
+
+private:
+    struct Retired
+    {
+        const T* object = nullptr;
+        Domain::Epoch epoch = 0;
+    };
+
+    void publish(const T* object)
+    {
+        auto lock = std::lock_guard(writeLock);
+        replace(object);
+    }
+
+    void replace(const T* object)
+    {
+        auto* previous = current.exchange(object);
+        retired.add(Retired {previous, Domain::get().advance()});
+        reclaimRetired();
+    }
+
+    void reclaimRetired()
+    {
+        auto oldest = Domain::get().getOldestPinned();
+
+        retired.eraseIf(
+            [oldest](const Retired& item)
+            {
+                if (item.epoch > oldest)
+                    return false;
+
+                delete item.object;
+                return true;
+            });
+    }
+
+    Atomic<const T*> current;
+    Vector<Retired> retired;
+    mutable std::mutex writeLock;
+};
+} // namespace EA
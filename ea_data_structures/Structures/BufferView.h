@@ -1,19 +1,37 @@
 #pragma once
 
+#include "../Utilities/SIMD.h"
+#include <algorithm>
+#include <type_traits>
+
 namespace EA
 {
 //A non-owning view over a contiguous buffer of T, carrying just a pointer and
 //a size. Similar to std::span but with int-based size semantics matching the
 //rest of this library.
+//
+//The DSP operations below go through the SIMD kernels in Utilities/SIMD.h.
+//Operations that take a second buffer only touch the samples both have.
 template <typename T>
 struct BufferView
 {
+    using ValueType = std::remove_const_t<T>;
+
     BufferView(T* bufferToUse, int sizeToUse)
         : buffer(bufferToUse)
         , bufSize(sizeToUse)
     {
     }
 
+    //Allows passing a BufferView<float> where a BufferView<const float> is taken
+    template <typename U>
+        requires std::is_convertible_v<U (*)[], T (*)[]>
+    BufferView(const BufferView<U>& other)
+        : buffer(other.buffer)
+        , bufSize(other.bufSize)
+    {
+    }
+
     int size() const noexcept { return bufSize; }
 
     T* begin() const noexcept { return buffer; }
@@ -21,8 +39,56 @@ struct BufferView
 
     T& operator[](int index) noexcept { return buffer[index]; }
 
+    void clear() { std::fill_n(buffer, bufSize, ValueType()); }
+
+    void copyFrom(const BufferView<const ValueType>& source)
+    {
+        std::copy_n(source.buffer, getCommonSize(source), buffer);
+    }
+
+    //buffer[i] += source[i] * gain
+    void add(const BufferView<const ValueType>& source, ValueType gain = 1)
+    {
+        if (gain == ValueType(1))
+            SIMD::mix(buffer, source.buffer, getCommonSize(source));
+        else
+            SIMD::mixWithGain(buffer, source.buffer, gain, getCommonSize(source));
+    }
+
+    //buffer[i] *= source[i]
+    void multiply(const BufferView<const ValueType>& source)
+    {
+        SIMD::multiply(buffer, source.buffer, getCommonSize(source));
+    }
+
+    void applyGain(ValueType gain) { SIMD::scale(buffer, gain, bufSize); }
+
+    //Ramps from startGain towards endGain, which the sample after the last one
+    //would get - so the next block can start its ramp at endGain
+    void applyGainRamp(ValueType startGain, ValueType endGain)
+    {
+        SIMD::applyGainRamp(buffer, startGain, endGain, bufSize);
+    }
+
+    SIMD::MinMax<ValueType> findMinMax() const
+    {
+        return SIMD::findMinMax<ValueType>(buffer, bufSize);
+    }
+
+    //The largest absolute value
+    ValueType getPeak() const { return SIMD::findPeak<ValueType>(buffer, bufSize); }
+
+    ValueType getRMS() const { return SIMD::getRMS<ValueType>(buffer, bufSize); }
+
     T* buffer = nullptr;
     int bufSize = 0;
+
+private:
+    template <typename U>
+    int getCommonSize(const BufferView<U>& other) const noexcept
+    {
+        return std::min(bufSize, other.bufSize);
+    }
 };
 
 template <typename T>
@@ -65,9 +131,12 @@ struct TwoDimensionalBufferIterator
 //A view over a 2D buffer represented as `T* const*` (an array of row/channel
 //pointers) plus the number of rows and the row length. Iterating yields a
 //BufferView per row — intended for accessing multichannel audio buffers.
+//Per-channel operations apply the BufferView ones to every channel.
 template <typename T>
 struct TwoDimensionalBufferView
 {
+    using ValueType = std::remove_const_t<T>;
+
     TwoDimensionalBufferView(T* const* bufferToUse,
                              int sizeToUse,
                              int internalSizeToUse)
@@ -83,6 +152,80 @@ struct TwoDimensionalBufferView
         return {buffer + size, internalSize};
     }
 
+    BufferView<T> operator[](int channel) const
+    {
+        return {buffer[channel], internalSize};
+    }
+
+    void clear()
+    {
+        for (auto channel: *this)
+            channel.clear();
+    }
+
+    void applyGain(ValueType gain)
+    {
+        for (auto channel: *this)
+            channel.applyGain(gain);
+    }
+
+    void applyGainRamp(ValueType startGain, ValueType endGain)
+    {
+        for (auto channel: *this)
+            channel.applyGainRamp(startGain, endGain);
+    }
+
+    template <typename U>
+    void copyFrom(const TwoDimensionalBufferView<U>& source)
+    {
+        auto numChannels = std::min(size, source.size);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            (*this)[channel].copyFrom(source[channel]);
+    }
+
+    template <typename U>
+    void add(const TwoDimensionalBufferView<U>& source, ValueType gain = 1)
+    {
+        auto numChannels = std::min(size, source.size);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            (*this)[channel].add(source[channel], gain);
+    }
+
+    //The largest absolute value across all channels
+    ValueType getPeak() const
+    {
+        auto peak = ValueType();
+
+        for (auto channel: *this)
+            peak = std::max(peak, channel.getPeak());
+
+        return peak;
+    }
+
+    //Writes the channels frame by frame into dest (size * internalSize
+    //samples), stopping early if dest is shorter
+    void interleaveTo(const BufferView<ValueType>& dest) const
+    {
+        if (size <= 0)
+            return;
+
+        auto numSamples = std::min(internalSize, dest.size() / size);
+        SIMD::interleave<ValueType>(dest.buffer, buffer, size, numSamples);
+    }
+
+    //The reverse of interleaveTo(): splits frames of size samples into the
+    //channels
+    void deinterleaveFrom(const BufferView<const ValueType>& source)
+    {
+        if (size <= 0)
+            return;
+
+        auto numSamples = std::min(internalSize, source.size() / size);
+        SIMD::deinterleave<ValueType>(buffer, source.buffer, size, numSamples);
+    }
+
     T* const* buffer;
     int size;
     int internalSize;
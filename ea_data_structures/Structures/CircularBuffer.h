@@ -1,6 +1,9 @@
 #pragma once
 
+#include "BufferView.h"
 #include "Vector.h"
+#include <algorithm>
+#include <bit>
 
 //A simple circular buffer, meant to implement things like an audio delay line
 namespace CircularAccess
@@ -11,11 +14,41 @@ T wrap(T index, T size) noexcept
 {
     return (index % size + size) % size;
 }
+
+//The same as wrap() when the size is a power of two (mask being size - 1),
+//without the divisions. Negative indexes wrap too, since & keeps the low bits
+//of a two's complement number.
+template <typename T>
+T wrapMasked(T index, T mask) noexcept
+{
+    return index & mask;
+}
 } // namespace CircularAccess
 
 namespace EA
 {
+//How a CircularBuffer wraps its indexes:
+//Modulo works with any size but costs two divisions per access.
+//PowerOfTwo rounds the size up to the next power of two and wraps with a mask.
+enum class CircularIndexing
+{
+    Modulo,
+    PowerOfTwo
+};
+
+//A range of a CircularBuffer as (up to) two contiguous pieces: from the start
+//index to the end of the storage, and the part that wrapped to its start.
+//Lets whole blocks be copied or processed without wrapping every index.
 template <typename T>
+struct CircularSegments
+{
+    int size() const noexcept { return first.size() + second.size(); }
+
+    BufferView<T> first;
+    BufferView<T> second;
+};
+
+template <typename T, CircularIndexing Indexing = CircularIndexing::Modulo>
 class CircularBuffer
 {
 public:
@@ -28,25 +61,99 @@ public:
     template <typename SizeType>
     T& operator[](SizeType index) noexcept
     {
-        auto wrapped = CircularAccess::wrap(index, (SizeType) internal.size());
-        return internal[wrapped];
+        return internal[wrap(index)];
+    }
+
+    template <typename SizeType>
+    const T& operator[](SizeType index) const noexcept
+    {
+        return internal[wrap(index)];
     }
 
     int size() const noexcept { return internal.size(); }
 
     void fill(T value = T(0)) { internal.fill(value); }
 
+    //In PowerOfTwo mode the size is rounded up to the next power of two
     void resize(int size, T defaultValue = T(0))
     {
+        if constexpr (Indexing == CircularIndexing::PowerOfTwo)
+        {
+            if (size > 0)
+                size = (int) std::bit_ceil((unsigned) size);
+        }
+
         internal.clear();
         internal.resize(size);
+        mask = size - 1;
         fill(defaultValue);
     }
 
     void reserve(int size) { internal.reserve(size); }
 
+    //The numItems items from startIndex on (at most size() of them)
+    CircularSegments<T> getSegments(int startIndex, int numItems) noexcept
+    {
+        return makeSegments(internal.data(), startIndex, numItems);
+    }
+
+    CircularSegments<const T> getSegments(int startIndex,
+                                          int numItems) const noexcept
+    {
+        return makeSegments(internal.data(), startIndex, numItems);
+    }
+
+    //Copies source in starting at startIndex, wrapping around the end
+    void write(int startIndex, const BufferView<const T>& source)
+    {
+        auto segments = getSegments(startIndex, source.size());
+        auto* data = source.begin();
+        auto& [first, second] = segments;
+
+        std::copy_n(data, first.size(), first.begin());
+        std::copy_n(data + first.size(), second.size(), second.begin());
+    }
+
+    //Fills dest with the items starting at startIndex, wrapping around the end
+    void read(int startIndex, const BufferView<T>& dest) const
+    {
+        auto segments = getSegments(startIndex, dest.size());
+        auto* data = dest.begin();
+        auto& [first, second] = segments;
+
+        std::copy_n(first.begin(), first.size(), data);
+        std::copy_n(second.begin(), second.size(), data + first.size());
+    }
+
 private:
+    template <typename SizeType>
+    SizeType wrap(SizeType index) const noexcept
+    {
+        if constexpr (Indexing == CircularIndexing::PowerOfTwo)
+            return CircularAccess::wrapMasked(index, (SizeType) mask);
+        else
+            return CircularAccess::wrap(index, (SizeType) internal.size());
+    }
+
+    template <typename Pointer>
+    auto makeSegments(Pointer data, int startIndex, int numItems) const noexcept
+    {
+        using Item = std::remove_pointer_t<Pointer>;
+
+        numItems = std::clamp(numItems, 0, size());
+
+        if (size() == 0)
+            return CircularSegments<Item> {{data, 0}, {data, 0}};
+
+        auto start = wrap(startIndex);
+        auto firstSize = std::min(numItems, size() - start);
+
+        return CircularSegments<Item> {{data + start, firstSize},
+                                       {data, numItems - firstSize}};
+    }
+
     Vector<T> internal;
+    int mask = -1;
 };
 
 } // namespace EA
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "CircularBuffer.h"
+#include <algorithm>
+#include <cmath>
+
+/*Block-based fractional delay reads from a CircularBuffer, for delay lines,
+choruses and the like.
+
+Output sample i is read delays[i] samples behind position writeIndex + i, so
+a block that was just written starting at writeIndex can be read back with
+per-sample modulated delays in one call. Delays are expected to be at least
+0 and to stay a few samples short of the buffer size.
+
+Rather than wrapping every index, a block first works out the range of the
+buffer its delays can touch. When that range doesn't cross the end of the
+storage (almost every block) the points are read straight from one pointer,
+and a block that crosses it picks between the two pieces with a compare.
+Each block is then processed in chunks: positions and fractions, gathering
+the points, and interpolating are separate loops, so the arithmetic ones
+vectorize.
+*/
+
+namespace EA
+{
+//The stateless interpolators: each reads NumPoints samples, starting
+//PointsBefore samples before the integer part of the position
+namespace Interpolators
+{
+struct Linear
+{
+    static constexpr int numPoints = 2;
+    static constexpr int pointsBefore = 0;
+
+    template <typename T>
+    static T interpolate(const T* points, T t) noexcept
+    {
+        return points[0] + t * (points[1] - points[0]);
+    }
+};
+
+//4 point, 3rd order Hermite (Catmull-Rom)
+struct Hermite
+{
+    static constexpr int numPoints = 4;
+    static constexpr int pointsBefore = 1;
+
+    template <typename T>
+    static T interpolate(const T* points, T t) noexcept
+    {
+        auto c1 = T(0.5) * (points[2] - points[0]);
+        auto c2 = points[0] - T(2.5) * points[1] + T(2) * points[2]
+                  - T(0.5) * points[3];
+        auto c3 =
+            T(0.5) * (points[3] - points[0]) + T(1.5) * (points[1] - points[2]);
+
+        return ((c3 * t + c2) * t + c1) * t + points[1];
+    }
+};
+
+//4 point, 3rd order Lagrange
+struct Lagrange
+{
+    static constexpr int numPoints = 4;
+    static constexpr int pointsBefore = 1;
+
+    template <typename T>
+    static T interpolate(const T* points, T t) noexcept
+    {
+        auto previous = t + T(1);
+        auto next = t - T(1);
+        auto afterNext = t - T(2);
+
+        return -points[0] * t * next * afterNext / T(6)
+               + points[1] * previous * next * afterNext / T(2)
+               - points[2] * previous * t * afterNext / T(2)
+               + points[3] * previous * t * next / T(6);
+    }
+};
+} // namespace Interpolators
+
+namespace Detail
+{
+constexpr int interpolationChunkSize = 64;
+
+//The buffer positions [start, start + size) a block of reads can touch
+struct CircularReadRange
+{
+    int start = 0;
+    int size = 0;
+};
+
+template <int NumPoints, int PointsBefore, typename T>
+CircularReadRange getReadRange(int writeIndex, const T* delays, int numSamples)
+{
+    auto delayRange = SIMD::findMinMax(delays, numSamples);
+    auto first = writeIndex - (int) std::ceil(delayRange.max) - PointsBefore;
+    auto last = writeIndex + numSamples - 1 - (int) std::ceil(delayRange.min);
+
+    //One extra sample in case a position rounds up to the next integer
+    last += NumPoints - PointsBefore;
+
+    return {first, last - first + 1};
+}
+
+//Calls process(start, count, points, fractions) for every chunk of the
+//block, with the points around each read gathered through fetch(), which
+//takes indexes relative to the start of the range.
+//Positions are relative to the range start and never negative, so
+//truncating them is flooring them.
+template <int NumPoints,
+          int PointsBefore,
+          typename T,
+          typename Fetch,
+          typename Process>
+void gatherChunks(
+    int offset, const T* delays, int numSamples, Fetch fetch, Process process)
+{
+    constexpr int chunkSize = interpolationChunkSize;
+
+    int indexes[chunkSize];
+    T fractions[chunkSize];
+    T points[chunkSize][NumPoints];
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        auto count = std::min(chunkSize, numSamples - start);
+
+        for (int index = 0; index < count; ++index)
+        {
+            auto position = (T) (offset + start + index) - delays[start + index];
+            indexes[index] = (int) position;
+            fractions[index] = position - (T) indexes[index];
+        }
+
+        for (int index = 0; index < count; ++index)
+        {
+            auto first = indexes[index] - PointsBefore;
+
+            for (int point = 0; point < NumPoints; ++point)
+                points[index][point] = fetch(first + point);
+        }
+
+        process(start, count, points, fractions);
+    }
+}
+
+//Reads from a single pointer when the range is contiguous in storage, and
+//picks one of the two segments when it crosses the end. Only delays spanning
+//more than the whole buffer wrap every point through it.
+template <int NumPoints,
+          int PointsBefore,
+          typename T,
+          CircularIndexing Indexing,
+          typename Process>
+void readChunks(const CircularBuffer<T, Indexing>& buffer,
+                int writeIndex,
+                const T* delays,
+                int numSamples,
+                Process process)
+{
+    auto range =
+        getReadRange<NumPoints, PointsBefore>(writeIndex, delays, numSamples);
+    auto offset = writeIndex - range.start;
+    auto segments = buffer.getSegments(range.start, range.size);
+
+    auto firstSize = segments.first.size();
+
+    if (firstSize == range.size)
+    {
+        auto* origin = segments.first.begin();
+        auto fetch = [origin](int index) { return origin[index]; };
+
+        gatherChunks<NumPoints, PointsBefore>(
+            offset, delays, numSamples, fetch, process);
+    }
+    else if (segments.size() == range.size)
+    {
+        auto* first = segments.first.begin();
+        auto* second = segments.second.begin();
+        auto fetch = [first, second, firstSize](int index)
+        { return index < firstSize ? first[index] : second[index - firstSize]; };
+
+        gatherChunks<NumPoints, PointsBefore>(
+            offset, delays, numSamples, fetch, process);
+    }
+    else
+    {
+        auto fetch = [&buffer, start = range.start](int index)
+        { return buffer[start + index]; };
+
+        gatherChunks<NumPoints, PointsBefore>(
+            offset, delays, numSamples, fetch, process);
+    }
+}
+} // namespace Detail
+
+//Reads output.size() samples (or delays.size(), if fewer) at fractional
+//delays with one of the Interpolators, e.g.:
+//readInterpolated<Interpolators::Hermite>(buffer, writeIndex, delays, output)
+template <typename Interpolator, typename T, CircularIndexing Indexing>
+void readInterpolated(const CircularBuffer<T, Indexing>& buffer,
+                      int writeIndex,
+                      const BufferView<const T>& delays,
+                      const BufferView<T>& output)
+{
+    constexpr int numPoints = Interpolator::numPoints;
+    constexpr int pointsBefore = Interpolator::pointsBefore;
+
+    auto numSamples = std::min(delays.size(), output.size());
+
+    if (numSamples <= 0 || buffer.size() == 0)
+        return;
+
+    auto* dest = output.begin();
+
+    auto process =
+        [dest](int start, int count, const auto& points, const auto& fractions)
+    {
+        for (int index = 0; index < count; ++index)
+        {
+            dest[start + index] =
+                Interpolator::interpolate(points[index], fractions[index]);
+        }
+    };
+
+    Detail::readChunks<numPoints, pointsBefore>(
+        buffer, writeIndex, delays.begin(), numSamples, process);
+}
+
+//First order all-pass interpolation: flat magnitude response, so it doesn't
+//dull the signal like the polynomial interpolators, at the cost of some phase
+//error while the delay moves. It's recursive, so each stream of reads needs
+//its own reader, and it suits slowly changing delays (e.g. a chorus) better
+//than jumps. The fractional part is kept in [0.5, 1.5) for stability.
+template <typename T>
+class AllPassReader
+{
+public:
+    template <CircularIndexing Indexing>
+    void read(const CircularBuffer<T, Indexing>& buffer,
+              int writeIndex,
+              const BufferView<const T>& delays,
+              const BufferView<T>& output)
+    {
+        auto numSamples = std::min(delays.size(), output.size());
+
+        if (numSamples <= 0 || buffer.size() == 0)
+            return;
+
+        auto* dest = output.begin();
+
+        auto process = [this, dest](int start,
+                                    int count,
+                                    const auto& points,
+                                    const auto& fractions)
+        {
+            for (int index = 0; index < count; ++index)
+            {
+                auto* samples = points[index];
+                auto fraction = fractions[index];
+                auto lower = fraction <= T(0.5);
+
+                auto older = lower ? samples[0] : samples[1];
+                auto newer = lower ? samples[1] : samples[2];
+                auto delay = (lower ? T(1) : T(2)) - fraction;
+                auto coefficient = (T(1) - delay) / (T(1) + delay);
+
+                previous = older + coefficient * (newer - previous);
+                dest[start + index] = previous;
+            }
+        };
+
+        Detail::readChunks<3, 0>(
+            buffer, writeIndex, delays.begin(), numSamples, process);
+    }
+
+    void reset() noexcept { previous = T(0); }
+
+private:
+    T previous = T(0);
+};
+} // namespace EA
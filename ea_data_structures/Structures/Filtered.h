@@ -42,9 +42,7 @@ struct Filtered
 
     void removeAll()
     {
-        for (int index = indexes.getLastElementIndex(); index >= 0; --index)
-            container.removeAt(indexes[index]);
-
+        Vectors::removeIndexes(container, indexes);
         indexes.clear();
     }
 
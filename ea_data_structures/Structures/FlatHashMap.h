@@ -0,0 +1,576 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include "../Allocators/DefaultAllocators.h"
+#include "../Utilities/MapUtilities.h"
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define EA_FLAT_HASH_MAP_SSE2 1
+#endif
+
+/*An open-addressing hash map sharing MapVector's API (getValue, getOrCreate,
+remove, eraseIf, iteration over KeyValuePairs).
+
+Elements live in one flat array of slots next to an array of one-byte control
+words, so inserting never allocates per node, and a lookup touches the control
+bytes of a 16-slot group and usually a single slot.
+
+Each control byte is either empty, deleted, or holds 7 bits of the key's hash.
+A lookup compares all 16 control bytes of a group at once (with SSE2 when
+available), only compares keys for slots whose hash bits match, and stops at
+the first group that still has an empty slot.
+
+Unlike MapVector, iteration order is unspecified and any insertion may move
+the elements, invalidating iterators and pointers to values.
+*/
+namespace EA
+{
+namespace FlatHash
+{
+using Control = std::int8_t;
+
+constexpr Control emptyControl = -128;
+constexpr Control deletedControl = -2;
+constexpr int groupSize = 16;
+
+//The 16 control bytes of a group, matched as bit masks (bit i = slot i)
+class Group
+{
+public:
+    explicit Group(const Control* controls) noexcept
+#if defined(EA_FLAT_HASH_MAP_SSE2)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controls)))
+    {
+    }
+#else
+        : bytes(controls)
+    {
+    }
+#endif
+
+    unsigned match(Control hashBits) const noexcept
+    {
+#if defined(EA_FLAT_HASH_MAP_SSE2)
+        auto wanted = _mm_set1_epi8(hashBits);
+        return (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(wanted, bytes));
+#else
+        return matchWith([hashBits](Control c) { return c == hashBits; });
+#endif
+    }
+
+    unsigned matchEmpty() const noexcept { return match(emptyControl); }
+
+    //Empty and deleted are the only negative values below -1
+    unsigned matchEmptyOrDeleted() const noexcept
+    {
+#if defined(EA_FLAT_HASH_MAP_SSE2)
+        auto special = _mm_cmpgt_epi8(_mm_set1_epi8(-1), bytes);
+        return (unsigned) _mm_movemask_epi8(special);
+#else
+        return matchWith([](Control c) { return c < -1; });
+#endif
+    }
+
+private:
+#if defined(EA_FLAT_HASH_MAP_SSE2)
+    __m128i bytes;
+#else
+    template <typename Pred>
+    unsigned matchWith(Pred pred) const noexcept
+    {
+        auto mask = 0u;
+
+        for (int index = 0; index < groupSize; ++index)
+            mask |= (unsigned) pred(bytes[index]) << index;
+
+        return mask;
+    }
+
+    const Control* bytes;
+#endif
+};
+
+//Scrambles the std::hash result (which is the identity for integers on
+//most standard libraries) so both the group index and the 7 control bits
+//are well distributed
+inline std::uint64_t mix(std::uint64_t hash) noexcept
+{
+    hash *= 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 32);
+}
+} // namespace FlatHash
+
+template <typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>>
+class FlatHashMap
+{
+    using Control = FlatHash::Control;
+    using Group = FlatHash::Group;
+
+public:
+    using key_type = KeyType;
+    using ElementType = MapUtils::Detail::KeyValuePair<KeyType, ValueType>;
+
+    template <typename MapType, typename Element>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Element*;
+        using reference = Element&;
+
+        IteratorBase() = default;
+        IteratorBase(MapType* mapToUse, int indexToUse)
+            : map(mapToUse)
+            , index(indexToUse)
+        {
+        }
+
+        reference operator*() const { return map->slots[index]; }
+        pointer operator->() const { return &map->slots[index]; }
+
+        IteratorBase& operator++()
+        {
+            index = map->getNextFullSlot(index + 1);
+            return *this;
+        }
+
+        IteratorBase operator++(int)
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        bool operator==(const IteratorBase& other) const
+        {
+            return index == other.index;
+        }
+
+        bool operator!=(const IteratorBase& other) const
+        {
+            return index != other.index;
+        }
+
+    private:
+        MapType* map = nullptr;
+        int index = 0;
+    };
+
+    using Iterator = IteratorBase<FlatHashMap, ElementType>;
+    using ConstIterator = IteratorBase<const FlatHashMap, const ElementType>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(const FlatHashMap& other)
+    {
+        reserve(other.size());
+
+        for (auto& element: other)
+            insertUnique(element.first, element.second);
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept { swap(other); }
+
+    ~FlatHashMap() { release(); }
+
+    FlatHashMap& operator=(const FlatHashMap& other)
+    {
+        if (this != &other)
+        {
+            auto copy = FlatHashMap(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            swap(other);
+        }
+
+        return *this;
+    }
+
+    void swap(FlatHashMap& other) noexcept
+    {
+        std::swap(controls, other.controls);
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(count, other.count);
+        std::swap(growthLeft, other.growthLeft);
+    }
+
+    Iterator begin() { return {this, getNextFullSlot(0)}; }
+    Iterator end() { return {this, capacity}; }
+
+    ConstIterator begin() const { return {this, getNextFullSlot(0)}; }
+    ConstIterator end() const { return {this, capacity}; }
+
+    ConstIterator find(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return {this, index};
+
+        return end();
+    }
+
+    Iterator find(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return {this, index};
+
+        return end();
+    }
+
+    bool contains(const KeyType& key) const { return getIndexOf(key) >= 0; }
+
+    template <typename T>
+    const ValueType* getFirstMatch(const T& other) const
+    {
+        for (auto& element: *this)
+        {
+            if (element.second == other)
+                return &element.second;
+        }
+
+        return nullptr;
+    }
+
+    template <typename T>
+    bool hasMatch(const T& other) const
+    {
+        return getFirstMatch(other) != nullptr;
+    }
+
+    const ValueType* getValue(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &slots[index].second;
+
+        return nullptr;
+    }
+
+    ValueType* getValue(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &slots[index].second;
+
+        return nullptr;
+    }
+
+    void remove(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            removeSlot(index);
+    }
+
+    template <typename Callable>
+    void eraseIf(Callable&& callable)
+    {
+        for (int index = 0; index < capacity; ++index)
+        {
+            if (isFull(controls[index]) && callable(slots[index].second))
+                removeSlot(index);
+        }
+    }
+
+    //Constructs the value in place if the key isn't there yet. If it is,
+    //the existing value is returned untouched.
+    template <typename... Args>
+    ValueType& emplace(const KeyType& key, Args&&... args)
+    {
+        if (auto* value = getValue(key))
+            return *value;
+
+        return insertUnique(key, std::forward<Args>(args)...);
+    }
+
+    ValueType& getOrCreate(const KeyType& key) { return emplace(key); }
+    ValueType& operator[](const KeyType& key) { return getOrCreate(key); }
+
+    void clear()
+    {
+        destroyElements();
+        resetControls();
+        count = 0;
+    }
+
+    //Makes room for numItems elements without any further rehashing.
+    //Deleted slots left by remove() don't count as room, so if there are
+    //too many of them this rehashes at the same capacity to clear them.
+    void reserve(int numItems)
+    {
+        if (numItems - count > growthLeft)
+            rehash(std::max(capacity, getCapacityFor(numItems)));
+    }
+
+    template <typename Func>
+    const KeyType* getKeyBy(Func comparison) const
+    {
+        for (auto& element: *this)
+        {
+            if (comparison(element.second))
+                return &element.first;
+        }
+
+        return nullptr;
+    }
+
+    const KeyType* getKeyByValue(const ValueType& value) const
+    {
+        auto comparison = [&](const ValueType& v) { return value == v; };
+        return getKeyBy(comparison);
+    }
+
+    int size() const noexcept { return count; }
+    bool empty() const noexcept { return count == 0; }
+    int getCapacity() const noexcept { return capacity; }
+
+    //The slot index holding the key, or -1 if it isn't in the map
+    int getIndexOf(const KeyType& key) const
+    {
+        if (capacity == 0)
+            return -1;
+
+        auto hash = getHash(key);
+        auto hashBits = getControlBits(hash);
+        auto group = getFirstGroup(hash);
+
+        for (int probe = 0; probe < getNumGroups(); ++probe)
+        {
+            auto controlGroup = Group(controls + group * FlatHash::groupSize);
+
+            auto mask = controlGroup.match(hashBits);
+
+            for (; mask != 0; mask &= mask - 1)
+            {
+                auto index = group * FlatHash::groupSize + std::countr_zero(mask);
+
+                if (slots[index].keyEqualsTo(key))
+                    return index;
+            }
+
+            if (controlGroup.matchEmpty() != 0)
+                return -1;
+
+            group = getNextGroup(group, probe);
+        }
+
+        return -1;
+    }
+
+private:
+    template <typename... Args>
+    ValueType& insertUnique(const KeyType& key, Args&&... args)
+    {
+        if (growthLeft == 0)
+            growForInsert();
+
+        auto hash = getHash(key);
+        auto index = findInsertSlot(hash);
+        auto* slot = slots + index;
+
+        new (slot) ElementType(key, std::forward<Args>(args)...);
+
+        if (controls[index] == FlatHash::emptyControl)
+            --growthLeft;
+
+        controls[index] = getControlBits(hash);
+        ++count;
+
+        return slot->second;
+    }
+
+    int findInsertSlot(std::uint64_t hash) const noexcept
+    {
+        auto group = getFirstGroup(hash);
+
+        for (int probe = 0;; ++probe)
+        {
+            auto controlGroup = Group(controls + group * FlatHash::groupSize);
+
+            if (auto mask = controlGroup.matchEmptyOrDeleted())
+                return group * FlatHash::groupSize + std::countr_zero(mask);
+
+            group = getNextGroup(group, probe);
+        }
+    }
+
+    //A slot can go straight back to empty if its group still has an empty
+    //slot, since probing would have stopped at this group anyway. Otherwise
+    //it has to be marked deleted so lookups keep probing past it.
+    void removeSlot(int index)
+    {
+        slots[index].~ElementType();
+        --count;
+
+        auto groupStart = index - index % FlatHash::groupSize;
+
+        if (Group(controls + groupStart).matchEmpty() != 0)
+        {
+            controls[index] = FlatHash::emptyControl;
+            ++growthLeft;
+        }
+        else
+            controls[index] = FlatHash::deletedControl;
+    }
+
+    //When deleted slots are what's using up the load, rehashing at the same
+    //capacity is enough to reclaim them
+    void growForInsert()
+    {
+        if (capacity > 0 && count + 1 <= getMaxLoad(capacity) / 2)
+            rehash(capacity);
+        else
+            rehash(std::max(FlatHash::groupSize, capacity * 2));
+    }
+
+    void rehash(int newCapacity)
+    {
+        auto* oldControls = controls;
+        auto* oldSlots = slots;
+        auto oldCapacity = capacity;
+
+        controls = Allocators::allocate<Control>((size_t) newCapacity);
+        slots = Allocators::allocate<ElementType>((size_t) newCapacity);
+        capacity = newCapacity;
+        resetControls();
+
+        for (int index = 0; index < oldCapacity; ++index)
+        {
+            if (!isFull(oldControls[index]))
+                continue;
+
+            auto& element = oldSlots[index];
+            auto hash = getHash(element.first);
+            auto target = findInsertSlot(hash);
+
+            new (slots + target) ElementType(std::move(element));
+            element.~ElementType();
+
+            controls[target] = getControlBits(hash);
+        }
+
+        growthLeft -= count;
+        deallocate(oldControls, oldSlots, oldCapacity);
+    }
+
+    void resetControls() noexcept
+    {
+        for (int index = 0; index < capacity; ++index)
+            controls[index] = FlatHash::emptyControl;
+
+        growthLeft = getMaxLoad(capacity);
+    }
+
+    void destroyElements() noexcept
+    {
+        for (int index = 0; index < capacity; ++index)
+        {
+            if (isFull(controls[index]))
+                slots[index].~ElementType();
+        }
+    }
+
+    void release() noexcept
+    {
+        destroyElements();
+        deallocate(controls, slots, capacity);
+
+        controls = nullptr;
+        slots = nullptr;
+        capacity = 0;
+        count = 0;
+        growthLeft = 0;
+    }
+
+    static void
+        deallocate(Control* controlsToFree, ElementType* slotsToFree, int size)
+    {
+        if (size > 0)
+        {
+            Allocators::deallocate<Control>(controlsToFree, (size_t) size);
+            Allocators::deallocate<ElementType>(slotsToFree, (size_t) size);
+        }
+    }
+
+    int getNextFullSlot(int index) const noexcept
+    {
+        while (index < capacity && !isFull(controls[index]))
+            ++index;
+
+        return index;
+    }
+
+    //Up to 7/8 of the slots can be used before the table grows
+    static int getMaxLoad(int capacityToUse) noexcept
+    {
+        return capacityToUse - capacityToUse / 8;
+    }
+
+    static int getCapacityFor(int numItems) noexcept
+    {
+        auto result = FlatHash::groupSize;
+
+        while (getMaxLoad(result) < numItems)
+            result *= 2;
+
+        return result;
+    }
+
+    static bool isFull(Control control) noexcept { return control >= 0; }
+
+    static std::uint64_t getHash(const KeyType& key)
+    {
+        return FlatHash::mix((std::uint64_t) Hash()(key));
+    }
+
+    static Control getControlBits(std::uint64_t hash) noexcept
+    {
+        return (Control) (hash & 0x7F);
+    }
+
+    int getNumGroups() const noexcept { return capacity / FlatHash::groupSize; }
+
+    int getFirstGroup(std::uint64_t hash) const noexcept
+    {
+        return (int) ((hash >> 7) & (std::uint64_t) (getNumGroups() - 1));
+    }
+
+    //Triangular probing, which visits every group when the number of groups
+    //is a power of two
+    int getNextGroup(int group, int probe) const noexcept
+    {
+        return (group + probe + 1) & (getNumGroups() - 1);
+    }
+
+    Control* controls = nullptr;
+    ElementType* slots = nullptr;
+    int capacity = 0;
+    int count = 0;
+    int growthLeft = 0;
+};
+
+} // namespace EA
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../Flags/CacheLine.h"
+#include "../Flags/CopyableAtomic.h"
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace EA
+{
+/*
+ * Shares a T between any number of writer threads and readers that must never
+ * wait, e.g. a realtime thread (the "Left-Right" technique).
+ *
+ * Two copies of T are kept. Readers announce themselves on a counter and read
+ * whichever copy is current - two atomic increments, no locks, no retries, no
+ * copying. A writer changes the copy nobody is reading, makes it current,
+ * waits until the readers have left the other one, then changes that too.
+ *
+ * So modify() edits T in place (no full copy, however big T is), but calls
+ * the function twice: it has to do the same thing both times - assign or
+ * change values, not move out of captures.
+ *
+ * Writers take turns on a mutex and may wait for readers to finish, so
+ * don't write from the realtime thread.
+ */
+template <typename T>
+class LeftRight
+{
+public:
+    //Keeps the copy it started reading on safe to use until it's destroyed
+    class Reader
+    {
+    public:
+        explicit Reader(const LeftRight& ownerToUse) noexcept
+            : owner(&ownerToUse)
+            , version(ownerToUse.arrive())
+            , data(&ownerToUse.getCurrent())
+        {
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        ~Reader() { owner->depart(version); }
+
+        const T& operator*() const noexcept { return *data; }
+        const T* operator->() const noexcept { return data; }
+
+    private:
+        const LeftRight* owner;
+        int version;
+        const T* data;
+    };
+
+    explicit LeftRight(const T& initialValue = {})
+        : instances {initialValue, initialValue}
+    {
+    }
+
+    LeftRight(const LeftRight&) = delete;
+    LeftRight& operator=(const LeftRight&) = delete;
+
+    //Reader side, never waits
+    Reader getReader() const noexcept { return Reader(*this); }
+
+    template <typename Func>
+    decltype(auto) read(Func&& func) const
+    {
+        auto reader = getReader();
+        return func(*reader);
+    }
+
+    //Writer side, from any thread. func(T&) runs once on each copy.
+    template <typename Func>
+    void modify(Func&& func)
+    {
+        auto lock = std::lock_guard(writeLock);
+        auto current = currentIndex.value.load();
+        auto next = 1 - current;
+
+        func(instances[next]);
+        currentIndex.value.store(next);
+        waitForReaders();
+        func(instances[current]);
+    }
+
+    void set(const T& value)
+    {
+        modify([&value](T& data) { data = value; });
+    }
+
+private:
+    int arrive() const noexcept
+    {
+        auto version = versionIndex.value.load();
+        readers[version].value.fetch_add(1);
+        return version;
+    }
+
+    void depart(int version) const noexcept { readers[version].value.fetch_sub(1); }
+
+    const T& getCurrent() const noexcept
+    {
+        return instances[currentIndex.value.load()];
+    }
+
+    //Readers that arrived before the switch may still hold the old copy.
+    //Moving new arrivals to the other counter, and waiting for both counters
+    //to drain in turn, guarantees they're all gone - while readers keep
+    //arriving and leaving freely.
+    void waitForReaders()
+    {
+        auto previous = versionIndex.value.load();
+        auto next = 1 - previous;
+
+        waitUntilEmpty(next);
+        versionIndex.value.store(next);
+        waitUntilEmpty(previous);
+    }
+
+    void waitUntilEmpty(int version) const
+    {
+        while (readers[version].value.load() != 0)
+            std::this_thread::yield();
+    }
+
+    T instances[2];
+
+    CacheLinePadded<Atomic<int>> currentIndex;
+    CacheLinePadded<Atomic<int>> versionIndex;
+    mutable CacheLinePadded<Atomic<int>> readers[2];
+
+    std::mutex writeLock;
+};
+} // namespace EA
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Array.h"
+#include "../Flags/CacheLine.h"
+#include "../Flags/CopyableAtomic.h"
+#include <cstddef>
+
+namespace EA
+{
+/*
+ * A bounded, lock free queue that any number of threads can push to and pop
+ * from at the same time.
+ *
+ * Every slot carries a sequence number that says whose turn it is: a producer
+ * may write a slot when its sequence equals the producer's ticket, and a
+ * consumer may read it when it equals the ticket + 1. Threads only contend on
+ * the enqueue/dequeue counters (a single CAS each), never on a lock, so this
+ * keeps scaling where a spinlock around a Vector stops.
+ *
+ * tryPush() returns false when the queue is full and tryPop() returns false
+ * when it's empty; neither ever waits for another thread.
+ *
+ * Capacity must be a power of two. Like SPSCQueue, storage is in-place, T needs
+ * to be default constructible, and popped slots are moved from, not destroyed.
+ */
+template <typename T, int Capacity>
+class MPMCQueue
+{
+public:
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0,
+                  "MPMCQueue capacity must be a power of two");
+
+    MPMCQueue() noexcept
+    {
+        for (int index = 0; index < Capacity; ++index)
+            slots[index].sequence.store((size_t) index, std::memory_order_relaxed);
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    bool tryPush(const T& item) { return push(item); }
+    bool tryPush(T&& item) { return push(std::move(item)); }
+
+    bool tryPop(T& item)
+    {
+        auto& position = dequeuePosition.value;
+        auto ticket = position.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto& slot = getSlot(ticket);
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = (std::ptrdiff_t) sequence - (std::ptrdiff_t) (ticket + 1);
+
+            if (diff == 0)
+            {
+                if (position.compare_exchange_weak(
+                        ticket, ticket + 1, std::memory_order_relaxed))
+                {
+                    item = std::move(slot.value);
+                    auto next = ticket + (size_t) Capacity;
+                    slot.sequence.store(next, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                ticket = position.load(std::memory_order_relaxed);
+        }
+    }
+
+    //Only a snapshot - other threads may change it right after
+    int getNumReady() const noexcept
+    {
+        auto pushed = enqueuePosition.value.load(std::memory_order_acquire);
+        auto popped = dequeuePosition.value.load(std::memory_order_acquire);
+
+        return pushed > popped ? (int) (pushed - popped) : 0;
+    }
+
+    bool isEmpty() const noexcept { return getNumReady() == 0; }
+
+    static constexpr int getCapacity() noexcept { return Capacity; }
+
+private:
+    struct Slot
+    {
+        Atomic<size_t> sequence {0};
+        T value {};
+    };
+
+    template <typename U>
+    bool push(U&& item)
+    {
+        auto& position = enqueuePosition.value;
+        auto ticket = position.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto& slot = getSlot(ticket);
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = (std::ptrdiff_t) sequence - (std::ptrdiff_t) ticket;
+
+            if (diff == 0)
+            {
+                if (position.compare_exchange_weak(
+                        ticket, ticket + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::forward<U>(item);
+                    slot.sequence.store(ticket + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false;
+            else
+                ticket = position.load(std::memory_order_relaxed);
+        }
+    }
+
+    Slot& getSlot(size_t ticket) noexcept
+    {
+        return slots[(int) (ticket & (size_t) (Capacity - 1))];
+    }
+
+    CacheLinePadded<Atomic<size_t>> enqueuePosition;
+    CacheLinePadded<Atomic<size_t>> dequeuePosition;
+
+    Array<Slot, Capacity> slots;
+};
+
+} // namespace EA
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "BufferView.h"
+#include "Vector.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define EA_MIRRORED_MAPPING 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace EA
+{
+namespace Detail
+{
+//Maps the same physical memory twice, back to back, so the byte after the
+//end of the first copy is the first byte of the second.
+//Linux uses memfd_create, other POSIX systems an unlinked shm_open object.
+//Where neither works (or on Windows) data() is nullptr.
+class MirroredMapping
+{
+public:
+    //bytes has to be a multiple of getPageSize()
+    explicit MirroredMapping(size_t bytesToUse)
+    {
+#if defined(EA_MIRRORED_MAPPING)
+        auto fd = openSharedMemory();
+
+        if (fd < 0)
+            return;
+
+        if (ftruncate(fd, (off_t) bytesToUse) == 0)
+            map(fd, bytesToUse);
+
+        close(fd);
+#else
+        (void) bytesToUse;
+#endif
+    }
+
+    MirroredMapping(const MirroredMapping&) = delete;
+    MirroredMapping& operator=(const MirroredMapping&) = delete;
+
+    ~MirroredMapping()
+    {
+#if defined(EA_MIRRORED_MAPPING)
+        if (address != nullptr)
+            munmap(address, bytes * 2);
+#endif
+    }
+
+    void* data() const noexcept { return address; }
+
+    static size_t getPageSize()
+    {
+#if defined(EA_MIRRORED_MAPPING)
+        return (size_t) sysconf(_SC_PAGESIZE);
+#else
+        return 4096;
+#endif
+    }
+
+private:
+#if defined(EA_MIRRORED_MAPPING)
+    static int openSharedMemory()
+    {
+    #if defined(__linux__) && defined(MFD_CLOEXEC)
+        return memfd_create("ea_mirrored_buffer", MFD_CLOEXEC);
+    #else
+        static auto counter = std::atomic<int>();
+
+        //macOS limits the name to 31 characters
+        char name[32] {};
+        std::snprintf(name, sizeof(name), "/ea_%d_%d", (int) getpid(), counter++);
+
+        auto fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+
+        if (fd >= 0)
+            shm_unlink(name);
+
+        return fd;
+    #endif
+    }
+
+    //Reserves twice the size, then maps the file over both halves
+    void map(int fd, size_t size)
+    {
+        auto* reserved =
+            mmap(nullptr, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (reserved == MAP_FAILED)
+            return;
+
+        auto* base = static_cast<std::byte*>(reserved);
+        auto flags = MAP_SHARED | MAP_FIXED;
+
+        auto* first = mmap(base, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        auto* second = mmap(base + size, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+
+        if (first != base || second != base + size)
+        {
+            munmap(reserved, size * 2);
+            return;
+        }
+
+        address = reserved;
+        bytes = size;
+    }
+#endif
+
+    void* address = nullptr;
+    size_t bytes = 0;
+};
+} // namespace Detail
+
+/*
+ * A circular buffer whose storage is mapped twice in a row in virtual memory,
+ * so any window of up to size() items is one contiguous BufferView - DSP code
+ * can run straight over it with SIMD and no wrap checks, even where it
+ * crosses the end of the ring.
+ *
+ * The size is rounded up to a power of two that fills whole memory pages
+ * (so indexes wrap with a mask). T has to be trivially copyable.
+ *
+ * Where the memory can't be mapped twice (Windows, sizes that don't fill whole
+ * pages, or allowMirroring = false) it falls back to plain storage of twice
+ * the size: getWindow() copies the wrapped part of the window after the end,
+ * and the next call on the buffer copies it back. The results are the same,
+ * but only the latest window stays valid, and the copies cost time.
+ * isMirrored() tells which one is in use.
+ */
+template <typename T>
+class MirroredCircularBuffer
+{
+public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "MirroredCircularBuffer needs trivially copyable items");
+
+    explicit MirroredCircularBuffer(int minimumSize,
+                                    T initialValue = T(0),
+                                    bool allowMirroring = true)
+        : capacity(getCapacity(minimumSize))
+        , mask(capacity - 1)
+    {
+        auto bytes = (size_t) capacity * sizeof(T);
+
+        if (allowMirroring && bytes % Detail::MirroredMapping::getPageSize() == 0)
+        {
+            mapping = std::make_unique<Detail::MirroredMapping>(bytes);
+            data = static_cast<T*>(mapping->data());
+        }
+
+        if (data == nullptr)
+        {
+            fallback.resize(capacity * 2);
+            data = fallback.data();
+        }
+
+        fill(initialValue);
+    }
+
+    MirroredCircularBuffer(const MirroredCircularBuffer&) = delete;
+    MirroredCircularBuffer& operator=(const MirroredCircularBuffer&) = delete;
+
+    int size() const noexcept { return capacity; }
+
+    bool isMirrored() const noexcept { return fallback.empty(); }
+
+    template <typename SizeType>
+    T& operator[](SizeType index) noexcept
+    {
+        syncBack();
+        return data[(int) (index & (SizeType) mask)];
+    }
+
+    void fill(T value)
+    {
+        pendingTail = 0;
+        std::fill_n(data, capacity, value);
+    }
+
+    //numItems items (at most size()) from startIndex on, as one contiguous
+    //view. Writes through it land in the ring.
+    BufferView<T> getWindow(int startIndex, int numItems) noexcept
+    {
+        syncBack();
+
+        numItems = std::clamp(numItems, 0, capacity);
+        auto first = startIndex & mask;
+
+        if (!isMirrored())
+        {
+            pendingTail = std::max(0, first + numItems - capacity);
+            std::copy_n(data, pendingTail, data + capacity);
+        }
+
+        return {data + first, numItems};
+    }
+
+    //Copies source in starting at startIndex
+    void write(int startIndex, const BufferView<const T>& source)
+    {
+        getWindow(startIndex, source.size()).copyFrom(source);
+    }
+
+    //Fills dest with the items starting at startIndex
+    void read(int startIndex, const BufferView<T>& dest)
+    {
+        auto window = getWindow(startIndex, dest.size());
+        std::copy_n(window.begin(), window.size(), dest.begin());
+    }
+
+private:
+    static int getCapacity(int minimumSize)
+    {
+        auto pageItems = (int) (Detail::MirroredMapping::getPageSize() / sizeof(T));
+        auto size = std::max({minimumSize, pageItems, 1});
+
+        return (int) std::bit_ceil((unsigned) size);
+    }
+
+    //In fallback mode, copies what the last window wrote past the end back to
+    //the start of the ring
+    void syncBack() noexcept
+    {
+        if (pendingTail > 0)
+        {
+            std::copy_n(data + capacity, pendingTail, data);
+            pendingTail = 0;
+        }
+    }
+
+    int capacity;
+    int mask;
+    int pendingTail = 0;
+
+    std::unique_ptr<Detail::MirroredMapping> mapping;
+    Vector<T> fallback;
+    T* data = nullptr;
+};
+} // namespace EA
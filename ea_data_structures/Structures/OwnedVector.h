@@ -8,11 +8,19 @@
 
 namespace EA
 {
+//Kept in a RelocatingBuffer, so growing, inserting and removing move the
+//pointers with memcpy/memmove
 template <typename T>
-class OwnedVector : public Vector<OwningPointer<T>>
+using OwnedVectorBase = Vector<OwningPointer<T>,
+                               std::allocator<OwningPointer<T>>,
+                               Growth::Standard,
+                               VectorStorage::Relocating>;
+
+template <typename T>
+class OwnedVector : public OwnedVectorBase<T>
 {
 public:
-    using Vector<OwningPointer<T>>::Vector;
+    using OwnedVectorBase<T>::Vector;
 
     using ValueType = OwningPointer<T>;
 
@@ -104,11 +112,8 @@ public:
     template <typename A>
     void removeAllMatches(const A& elementToCheck)
     {
-        for (int index = this->getLastElementIndex(); index >= 0; --index)
-        {
-            if (*this->get(index) == elementToCheck)
-                this->removeAt(index);
-        }
+        this->eraseIf([&elementToCheck](const ValueType& element)
+                      { return *element == elementToCheck; });
     }
 
     template <typename Derived, typename... Args>
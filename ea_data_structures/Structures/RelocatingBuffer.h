@@ -0,0 +1,389 @@
+#pragma once
+
+#include "../ValueWrapper/RawStorage.h"
+#include "../ValueWrapper/Relocation.h"
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace EA
+{
+//The part of the std::vector interface that Vector and the Vectors helpers
+//use, over a buffer that grows, inserts and erases with Relocation. For
+//trivially relocatable elements (OwningPointer, Ref, RefOrOwn...) growing is
+//one memcpy and shifting is one memmove, where std::vector moves and
+//destroys them one by one.
+//Vector uses it with VectorStorage::Relocating, as OwnedVector does.
+template <typename T, typename Allocator = std::allocator<T>>
+class RelocatingBuffer
+{
+    static_assert(isTriviallyRelocatable<T>()
+                      || std::is_nothrow_move_constructible_v<T>,
+                  "Elements are relocated without a way to undo a throwing move");
+
+    using Traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RelocatingBuffer() = default;
+
+    explicit RelocatingBuffer(size_type numElements) { resize(numElements); }
+
+    RelocatingBuffer(size_type numElements, const T& value)
+    {
+        assign(numElements, value);
+    }
+
+    template <std::input_iterator Iterator>
+    RelocatingBuffer(Iterator first, Iterator last)
+    {
+        assign(first, last);
+    }
+
+    RelocatingBuffer(std::initializer_list<T> list)
+    {
+        assign(list.begin(), list.end());
+    }
+
+    RelocatingBuffer(const RelocatingBuffer& other)
+        : allocator(Traits::select_on_container_copy_construction(other.allocator))
+    {
+        assign(other.begin(), other.end());
+    }
+
+    RelocatingBuffer(RelocatingBuffer&& other) noexcept
+        : allocator(std::move(other.allocator))
+    {
+        takeFrom(other);
+    }
+
+    ~RelocatingBuffer() { release(); }
+
+    RelocatingBuffer& operator=(const RelocatingBuffer& other)
+    {
+        if (this != &other)
+            assign(other.begin(), other.end());
+
+        return *this;
+    }
+
+    RelocatingBuffer& operator=(RelocatingBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            allocator = std::move(other.allocator);
+            takeFrom(other);
+        }
+
+        return *this;
+    }
+
+    RelocatingBuffer& operator=(std::initializer_list<T> list)
+    {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    bool operator==(const RelocatingBuffer& other) const
+    {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator!=(const RelocatingBuffer& other) const
+    {
+        return !(*this == other);
+    }
+
+    size_type size() const noexcept { return size_type(finish - elements); }
+    size_type capacity() const noexcept { return size_type(storageEnd - elements); }
+    bool empty() const noexcept { return finish == elements; }
+
+    T* data() noexcept { return elements; }
+    const T* data() const noexcept { return elements; }
+
+    iterator begin() noexcept { return elements; }
+    iterator end() noexcept { return finish; }
+    const_iterator begin() const noexcept { return elements; }
+    const_iterator end() const noexcept { return finish; }
+    const_iterator cbegin() const noexcept { return elements; }
+    const_iterator cend() const noexcept { return finish; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    T& operator[](size_type index) noexcept { return elements[index]; }
+    const T& operator[](size_type index) const noexcept { return elements[index]; }
+
+    T& front() noexcept { return *elements; }
+    const T& front() const noexcept { return *elements; }
+    T& back() noexcept { return *(finish - 1); }
+    const T& back() const noexcept { return *(finish - 1); }
+
+    void reserve(size_type numElements)
+    {
+        if (numElements > capacity())
+            reallocate(numElements);
+    }
+
+    void resize(size_type numElements)
+    {
+        if (numElements <= size())
+        {
+            destroyFrom(elements + numElements);
+            return;
+        }
+
+        reserve(getGrownCapacity(numElements));
+
+        while (size() < numElements)
+        {
+            Traits::construct(allocator, finish);
+            ++finish;
+        }
+    }
+
+    void resize(size_type numElements, const T& value)
+    {
+        if (numElements <= size())
+        {
+            destroyFrom(elements + numElements);
+            return;
+        }
+
+        //value may be one of the elements
+        auto copy = T(value);
+        reserve(getGrownCapacity(numElements));
+
+        while (size() < numElements)
+        {
+            Traits::construct(allocator, finish, copy);
+            ++finish;
+        }
+    }
+
+    template <std::input_iterator Iterator>
+    void assign(Iterator first, Iterator last)
+    {
+        auto copy = RelocatingBuffer();
+
+        for (; first != last; ++first)
+            copy.emplace_back(*first);
+
+        *this = std::move(copy);
+    }
+
+    void assign(size_type numElements, const T& value)
+    {
+        auto copy = T(value);
+        clear();
+        reserve(numElements);
+
+        for (size_type index = 0; index < numElements; ++index)
+            emplace_back(copy);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (finish == storageEnd)
+            return *emplaceGrowing(size(), std::forward<Args>(args)...);
+
+        Traits::construct(allocator, finish, std::forward<Args>(args)...);
+        return *finish++;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() noexcept { destroyFrom(finish - 1); }
+
+    template <typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        auto index = size_type(position - elements);
+
+        if (finish == storageEnd)
+            return emplaceGrowing(index, std::forward<Args>(args)...);
+
+        if (index == size())
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return elements + index;
+        }
+
+        //Built before the shift, as args may refer to an element, and then
+        //relocated into the gap like the rest
+        auto element = RawStorage<T>();
+        element.create(std::forward<Args>(args)...);
+        auto* slot = elements + index;
+
+        Relocation::relocateOverlapping(slot, int(finish - slot), slot + 1);
+        Relocation::relocate(element.get(), 1, slot);
+        ++finish;
+
+        return slot;
+    }
+
+    iterator insert(const_iterator position, const T& value)
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value)
+    {
+        return emplace(position, std::move(value));
+    }
+
+    //The new elements are copied out first, since the range may be part of
+    //this buffer, then relocated into the gap
+    template <std::input_iterator Iterator>
+    iterator insert(const_iterator position, Iterator first, Iterator last)
+    {
+        auto index = size_type(position - elements);
+        auto added = RelocatingBuffer(first, last);
+        auto count = added.size();
+
+        if (count == 0)
+            return elements + index;
+
+        reserve(getGrownCapacity(size() + count));
+
+        auto* slot = elements + index;
+        Relocation::relocateOverlapping(slot, int(finish - slot), slot + count);
+        Relocation::relocate(added.elements, int(count), slot);
+
+        added.finish = added.elements;
+        finish += count;
+
+        return slot;
+    }
+
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto* start = elements + (first - elements);
+        auto* end = elements + (last - elements);
+
+        if (start == end)
+            return start;
+
+        destroy(start, end);
+        Relocation::relocateOverlapping(end, int(finish - end), start);
+        finish -= end - start;
+
+        return start;
+    }
+
+    void clear() noexcept { destroyFrom(elements); }
+
+    allocator_type get_allocator() const { return allocator; }
+
+private:
+    size_type getGrownCapacity(size_type required) const noexcept
+    {
+        return std::max(required, capacity() * 2);
+    }
+
+    void reallocate(size_type newCapacity)
+    {
+        auto* block = Traits::allocate(allocator, newCapacity);
+        auto count = size();
+
+        Relocation::relocate(elements, int(count), block);
+        adopt(block, count, newCapacity);
+    }
+
+    //The new element is created in the new block before the old ones move
+    //around it, as args may refer to one of them
+    template <typename... Args>
+    T* emplaceGrowing(size_type index, Args&&... args)
+    {
+        auto count = size();
+        auto newCapacity = getGrownCapacity(count + 1);
+        auto* block = Traits::allocate(allocator, newCapacity);
+
+        auto* slot = block + index;
+        Traits::construct(allocator, slot, std::forward<Args>(args)...);
+
+        Relocation::relocate(elements, int(index), block);
+        Relocation::relocate(elements + index, int(count - index), slot + 1);
+        adopt(block, count + 1, newCapacity);
+
+        return slot;
+    }
+
+    //Expects the old elements to be relocated out already
+    void adopt(T* block, size_type count, size_type newCapacity) noexcept
+    {
+        if (elements != nullptr)
+            Traits::deallocate(allocator, elements, capacity());
+
+        elements = block;
+        finish = block + count;
+        storageEnd = block + newCapacity;
+    }
+
+    void takeFrom(RelocatingBuffer& other) noexcept
+    {
+        elements = std::exchange(other.elements, nullptr);
+        finish = std::exchange(other.finish, nullptr);
+        storageEnd = std::exchange(other.storageEnd, nullptr);
+    }
+
+    void release() noexcept
+    {
+        clear();
+
+        if (elements != nullptr)
+            Traits::deallocate(allocator, elements, capacity());
+
+        elements = finish = storageEnd = nullptr;
+    }
+
+    void destroy(T* first, T* last) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (auto* element = first; element != last; ++element)
+                Traits::destroy(allocator, element);
+        }
+    }
+
+    void destroyFrom(T* first) noexcept
+    {
+        destroy(first, finish);
+        finish = first;
+    }
+
+    [[no_unique_address]] Allocator allocator;
+    T* elements = nullptr;
+    T* finish = nullptr;
+    T* storageEnd = nullptr;
+};
+} // namespace EA
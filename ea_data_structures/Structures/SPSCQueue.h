@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Array.h"
+#include "../Flags/CacheLine.h"
+#include "../Flags/CopyableAtomic.h"
+#include <algorithm>
+
+namespace EA
+{
+/*
+ * A bounded, lock free queue for exactly one producer thread and one consumer
+ * thread.
+ *
+ * Unlike Fifo, every pushed message is delivered, in order. Both sides are
+ * wait-free: tryPush() returns false instead of waiting when the queue is full,
+ * and tryPop() returns false when it's empty, so it's safe to call from the
+ * realtime thread.
+ *
+ * Storage is an in-place Array, so T needs to be default constructible and
+ * nothing is allocated after construction. Popped slots are moved from, not
+ * destroyed.
+ *
+ * The producer and consumer indexes live on separate cache lines, and each side
+ * keeps a cached copy of the other side's index so it only touches the shared
+ * line when its cached copy says the queue looks full/empty.
+ */
+template <typename T, int Capacity>
+class SPSCQueue
+{
+public:
+    static_assert(Capacity > 0, "SPSCQueue needs room for at least one element");
+
+    //Producer side:
+    bool tryPush(const T& item) { return push(item); }
+    bool tryPush(T&& item) { return push(std::move(item)); }
+
+    //Pushes as many items as there's room for, publishing them all at once.
+    //Returns how many were pushed.
+    int pushBulk(const T* items, int numItems)
+    {
+        auto& side = producer.value;
+        auto tail = side.index.load(std::memory_order_relaxed);
+        auto count = std::min(numItems, getFreeSpace(tail, side.cachedOther));
+
+        if (count < numItems)
+        {
+            side.cachedOther = consumer.value.index.load(std::memory_order_acquire);
+            count = std::min(numItems, getFreeSpace(tail, side.cachedOther));
+        }
+
+        for (int index = 0; index < count; ++index)
+        {
+            storage[tail] = items[index];
+            tail = getNext(tail);
+        }
+
+        side.index.store(tail, std::memory_order_release);
+        return count;
+    }
+
+    //Consumer side:
+    bool tryPop(T& item)
+    {
+        auto& side = consumer.value;
+        auto head = side.index.load(std::memory_order_relaxed);
+
+        if (head == side.cachedOther)
+        {
+            side.cachedOther = producer.value.index.load(std::memory_order_acquire);
+
+            if (head == side.cachedOther)
+                return false;
+        }
+
+        item = std::move(storage[head]);
+        side.index.store(getNext(head), std::memory_order_release);
+
+        return true;
+    }
+
+    //Pops up to maxItems into destination, releasing the slots all at once.
+    //Returns how many were popped.
+    int popBulk(T* destination, int maxItems)
+    {
+        auto& side = consumer.value;
+        auto head = side.index.load(std::memory_order_relaxed);
+        auto count = std::min(maxItems, getReady(head, side.cachedOther));
+
+        if (count < maxItems)
+        {
+            side.cachedOther = producer.value.index.load(std::memory_order_acquire);
+            count = std::min(maxItems, getReady(head, side.cachedOther));
+        }
+
+        for (int index = 0; index < count; ++index)
+        {
+            destination[index] = std::move(storage[head]);
+            head = getNext(head);
+        }
+
+        side.index.store(head, std::memory_order_release);
+        return count;
+    }
+
+    //Pops everything currently in the queue, calling func on each item
+    template <typename Callable>
+    int popAll(Callable&& func)
+    {
+        auto popped = 0;
+        auto item = T();
+
+        while (tryPop(item))
+        {
+            func(item);
+            ++popped;
+        }
+
+        return popped;
+    }
+
+    //Either side:
+    //Only a snapshot - the other thread may change it right after
+    int getNumReady() const noexcept
+    {
+        auto tail = producer.value.index.load(std::memory_order_acquire);
+        auto head = consumer.value.index.load(std::memory_order_acquire);
+
+        return getReady(head, tail);
+    }
+
+    bool isEmpty() const noexcept { return getNumReady() == 0; }
+
+    static constexpr int getCapacity() noexcept { return Capacity; }
+
+private:
+    //One slot always stays empty, so head == tail means empty
+    static constexpr int numSlots = Capacity + 1;
+
+    template <typename U>
+    bool push(U&& item)
+    {
+        auto& side = producer.value;
+        auto tail = side.index.load(std::memory_order_relaxed);
+        auto next = getNext(tail);
+
+        if (next == side.cachedOther)
+        {
+            side.cachedOther = consumer.value.index.load(std::memory_order_acquire);
+
+            if (next == side.cachedOther)
+                return false;
+        }
+
+        storage[tail] = std::forward<U>(item);
+        side.index.store(next, std::memory_order_release);
+
+        return true;
+    }
+
+    static int getNext(int index) noexcept
+    {
+        ++index;
+
+        if (index == numSlots)
+            index = 0;
+
+        return index;
+    }
+
+    static int getReady(int head, int tail) noexcept
+    {
+        auto ready = tail - head;
+        return ready < 0 ? ready + numSlots : ready;
+    }
+
+    static int getFreeSpace(int tail, int head) noexcept
+    {
+        return Capacity - getReady(head, tail);
+    }
+
+    //The index this side owns, and its last seen copy of the other side's
+    struct Side
+    {
+        Atomic<int> index {0};
+        int cachedOther = 0;
+    };
+
+    CacheLinePadded<Side> producer;
+    CacheLinePadded<Side> consumer;
+
+    Array<T, numSlots> storage;
+};
+
+} // namespace EA
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Fifo.h"
+#include "LeftRight.h"
+#include "SPSCQueue.h"
 
 namespace EA
 {
@@ -73,6 +75,46 @@ private:
     GUIToRealTime<T, fifoSize> fifo;
 };
 
+//A SharedWithRealTime for when several threads change the data (say the GUI
+//and an automation or network thread), or T is too big to copy on every
+//change. Changes are made in place with modify(), from any non-realtime
+//thread, and the realtime thread reads without ever waiting or copying:
+//
+//  shared.modify([](Params& params) { params.gain = 0.5f; });
+//
+//  //In processBlock:
+//  auto params = shared.getRealTime();
+//  process(params->gain);
+//
+//See LeftRight for the details (modify() runs its function on two copies).
+template <typename T>
+class SharedWithRealTimeMultiWriter
+{
+public:
+    explicit SharedWithRealTimeMultiWriter(const T& initialValue = {})
+        : shared(initialValue)
+    {
+    }
+
+    template <typename Func>
+    void modify(Func&& func)
+    {
+        shared.modify(std::forward<Func>(func));
+    }
+
+    void set(const T& value) { shared.set(value); }
+
+    //Call from the realtime thread, at the start of the block. The data stays
+    //safe to use, and unchanged, until the returned reader goes out of scope.
+    typename LeftRight<T>::Reader getRealTime() const noexcept
+    {
+        return shared.getReader();
+    }
+
+private:
+    LeftRight<T> shared;
+};
+
 //The counterpart to SharedWithRealTime for the opposite direction: the audio/
 //realtime thread push()es values, and the GUI thread polls updateFlag (a
 //monotonic counter) to know when a new value is available, then pull()s it.
@@ -94,4 +136,41 @@ struct RealTimeToGUI
     Fifo<T, FifoSize> fifo;
 };
 
+//Like RealTimeToGUI, but for events where the GUI needs every message and not
+//just the latest value (note on/off, clipping, parameter gestures...).
+//The realtime thread push()es without ever blocking; if the GUI falls so far
+//behind that the queue fills up, the message is dropped and counted in
+//getNumDropped(). The GUI thread calls process() from its timer.
+template <typename T, int Capacity = 256>
+class RealTimeToGUIMessages
+{
+public:
+    //Call from the realtime thread
+    bool push(const T& message) noexcept
+    {
+        if (queue.tryPush(message))
+            return true;
+
+        numDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    //Call from the GUI thread. Calls func on every message pushed so far,
+    //in order, and returns how many there were
+    template <typename Callable>
+    int process(Callable&& func)
+    {
+        return queue.popAll(std::forward<Callable>(func));
+    }
+
+    int getNumDropped() const noexcept
+    {
+        return numDropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    SPSCQueue<T, Capacity> queue;
+    Atomic<int> numDropped {0};
+};
+
 } // namespace EA
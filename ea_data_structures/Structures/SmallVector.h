@@ -1,112 +1,136 @@
 #pragma once
 
-#include "StaticVector.h"
+#include "../Allocators/DefaultAllocators.h"
+#include "../ValueWrapper/RawStorage.h"
+#include "../ValueWrapper/Relocation.h"
 #include "Vector.h"
+#include <utility>
 
 namespace EA
 {
-//A vector with small-buffer optimisation: elements live in a StaticVector of
-//size PreAllocatedSize until you exceed it, at which point storage switches
-//to a heap-backed Vector. isStatic() reports which mode is currently active.
+//A vector with small-buffer optimisation: elements live in an inline buffer
+//of PreAllocatedSize until you exceed it, then move to the heap.
+//There's a single representation (begin, end and capacity pointers, like
+//LLVM's SmallVector or std::vector) that aims at the inline buffer or at the
+//heap block, so data(), size() and indexing never check which one is in
+//use, and add() only compares two pointers. Keeping the end as a pointer
+//rather than an int count also means storing an int element can't alias
+//it, so push loops keep it in a register.
+//isStatic() reports whether the inline buffer is the one in use. Once on the
+//heap, the vector stays there.
 template <typename T, int PreAllocatedSize>
 struct SmallVector : VectorBase
 {
+    static_assert(PreAllocatedSize > 0, "SmallVector needs an inline capacity");
+
     using value_type = T;
     using Iterator = T*;
 
     SmallVector() = default;
     SmallVector(std::initializer_list<T> list) { add(list); }
 
-    bool empty() const noexcept { return size() == 0; }
-    int size() const noexcept
+    SmallVector(const SmallVector& other) { copyFrom(other); }
+
+    SmallVector(SmallVector&& other) noexcept { takeFrom(other); }
+
+    SmallVector& operator=(const SmallVector& other)
     {
-        if (isStatic())
-            return staticVec.size();
+        if (this != &other)
+            copyFrom(other);
 
-        return dynamicVec.size();
+        return *this;
     }
 
-    void insert(int position, const T& object)
+    SmallVector& operator=(SmallVector&& other) noexcept
     {
-        checkSwitch(1);
+        if (this != &other)
+        {
+            clear();
+            freeHeap();
+            takeFrom(other);
+        }
 
-        if (isStatic())
-            staticVec.insert(position, object);
-        else
-            dynamicVec.insert(position, object);
+        return *this;
     }
 
-    bool isStatic() const { return usingStatic; }
-
-    bool shouldSwitch(int sizeExtra) const
+    ~SmallVector()
     {
-        if (isStatic())
-            return size() + sizeExtra > PreAllocatedSize;
-
-        return false;
+        clear();
+        freeHeap();
     }
 
-    void checkSwitch(int sizeExtra)
+    bool empty() const noexcept { return finish == elements; }
+    int size() const noexcept { return int(finish - elements); }
+    int capacity() const noexcept { return int(storageEnd - elements); }
+
+    void reserve(int numElements)
     {
-        if (shouldSwitch(sizeExtra))
-            switchToDynamic(sizeExtra);
+        if (numElements > capacity())
+            moveToHeap(numElements);
     }
 
-    void switchToDynamic(int sizeExtra)
+    //The elements after position shift up in one move when T is trivially
+    //relocatable
+    void insert(int position, const T& object)
     {
-        dynamicVec.reserve(size() + sizeExtra);
+        if (position >= size())
+        {
+            create(object);
+            return;
+        }
+
+        auto item = T(object);
 
-        for (auto& element: *this)
-            dynamicVec.create(std::move(element));
+        if (finish == storageEnd)
+            moveToHeap(getGrownCapacity(1));
 
-        usingStatic = false;
-        staticVec.clear();
+        auto* slot = elements + position;
+        Relocation::relocateOverlapping(slot, size() - position, slot + 1);
+        new (slot) T(std::move(item));
+        ++finish;
     }
 
-    T& back() { return get(getLastElementIndex()); }
-    T& front() { return get(0); }
+    bool isStatic() const noexcept { return elements == getInlineData(); }
 
-    T& add(const T& elementToAdd) noexcept
+    bool shouldSwitch(int sizeExtra) const noexcept
     {
-        checkSwitch(1);
-
-        if (isStatic())
-            return staticVec.add(elementToAdd);
+        return size() + sizeExtra > capacity();
+    }
 
-        return dynamicVec.add(elementToAdd);
+    void checkSwitch(int sizeExtra)
+    {
+        if (shouldSwitch(sizeExtra))
+            switchToDynamic(sizeExtra);
     }
 
-    T& push_back(const T& elementToAdd) noexcept { return add(elementToAdd); }
+    void switchToDynamic(int sizeExtra) { moveToHeap(getGrownCapacity(sizeExtra)); }
 
-    T& add(T&& elementToAdd) noexcept
-    {
-        checkSwitch(1);
+    T& back() { return get(getLastElementIndex()); }
+    T& front() { return get(0); }
 
-        if (isStatic())
-            return staticVec.add(std::move(elementToAdd));
+    T& add(const T& elementToAdd) { return create(elementToAdd); }
+    T& push_back(const T& elementToAdd) { return add(elementToAdd); }
 
-        return dynamicVec.add(std::move(elementToAdd));
-    }
+    T& add(T&& elementToAdd) { return create(std::move(elementToAdd)); }
 
-    void add(std::initializer_list<T> items) noexcept
+    void add(std::initializer_list<T> items)
     {
-        checkSwitch((int) items.size());
+        reserve(size() + (int) items.size());
 
-        if (isStatic())
-            staticVec.add(items);
-        else
-            dynamicVec.add(items);
+        for (auto& item: items)
+            create(item);
     }
 
     template <typename... Args>
     T& create(Args&&... args)
     {
-        checkSwitch(1);
+        if (finish == storageEnd)
+            return growAndCreate(std::forward<Args>(args)...);
 
-        if (isStatic())
-            return staticVec.create(std::forward<Args>(args)...);
+        auto* element = new (finish) T(std::forward<Args>(args)...);
+        ++finish;
 
-        return dynamicVec.create(std::forward<Args>(args)...);
+        return *element;
     }
 
     template <typename... Args>
@@ -115,19 +139,13 @@ struct SmallVector : VectorBase
         return create(std::forward<Args>(args)...);
     }
 
-    T& get(int index) noexcept { return data()[index]; }
+    T& get(int index) noexcept { return elements[index]; }
     const T& operator[](int index) const noexcept { return get(index); }
 
     T& operator[](int index) noexcept { return get(index); }
-    const T& get(int index) const noexcept { return data()[index]; }
+    const T& get(int index) const noexcept { return elements[index]; }
 
-    void clear() noexcept
-    {
-        if (isStatic())
-            staticVec.clear();
-        else
-            dynamicVec.clear();
-    }
+    void clear() noexcept { destroyFrom(elements); }
 
     T* begin() noexcept { return data(); }
     T* end() noexcept { return data() + size(); }
@@ -146,12 +164,11 @@ struct SmallVector : VectorBase
 
     void copyFrom(const SmallVector& other)
     {
-        usingStatic = other.usingStatic;
+        clear();
+        reserve(other.size());
 
-        if (other.usingStatic)
-            staticVec = other.staticVec;
-        else
-            dynamicVec = other.dynamicVec;
+        for (auto& element: other)
+            create(element);
     }
 
     void copyFrom(const SmallVector& other, int startIndex, int numItems)
@@ -159,8 +176,8 @@ struct SmallVector : VectorBase
         auto targetSize = numItems - startIndex;
         auto adjustedSize = std::min(targetSize, other.size());
 
-        reserveAtLeast(adjustedSize);
         clear();
+        reserve(adjustedSize);
 
         for (int index = startIndex; index < startIndex; ++index)
             add(other[index]);
@@ -179,19 +196,11 @@ struct SmallVector : VectorBase
     template <typename A>
     void removeAllMatches(const A& element)
     {
-        Vectors::removeAllMatches(*this, element);
+        eraseIf([&element](const T& item) { return item == element; });
     }
 
     void resize(size_t numElements) { resize((int) numElements); }
-    void resize(int numElements)
-    {
-        checkSwitch(numElements - size());
-
-        if (isStatic())
-            staticVec.resize(numElements);
-        else
-            dynamicVec.resize(numElements);
-    }
+    void resize(int numElements) { resizeAndCreate(numElements); }
 
     template <typename FloatType>
     FloatType getIndexAsRelative(int index) const
@@ -230,31 +239,52 @@ struct SmallVector : VectorBase
     template <typename... Args>
     void resizeAndCreate(int numElements, Args&&... args)
     {
-        checkSwitch(numElements - size());
+        numElements = std::max(0, numElements);
 
-        if (isStatic())
-            staticVec.resizeAndCreate(numElements, std::forward<Args>(args)...);
-        else
-            dynamicVec.resizeAndCreate(numElements, std::forward<Args>(args)...);
+        if (numElements <= size())
+        {
+            destroyFrom(elements + numElements);
+            return;
+        }
+
+        reserve(numElements);
+
+        for (auto* last = elements + numElements; finish != last; ++finish)
+            new (finish) T(std::forward<Args>(args)...);
     }
 
     template <typename A>
     void mixFrom(A& other)
     {
-        for (int index = 0; index < size(); ++index)
-            get(index) += other[index];
+        if constexpr (SIMD::ContiguousOf<A, T>)
+            SIMD::mix(data(), other.data(), size());
+        else
+        {
+            for (int index = 0; index < size(); ++index)
+                get(index) += other[index];
+        }
     }
 
     void fill(const T& value)
     {
-        for (auto& element: *this)
-            element = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, size());
+        else
+        {
+            for (auto& element: *this)
+                element = value;
+        }
     }
 
     void fill(const T& value, int numItems)
     {
-        for (int index = 0; index < numItems; ++index)
-            get(index) = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, numItems);
+        else
+        {
+            for (int index = 0; index < numItems; ++index)
+                get(index) = value;
+        }
     }
 
     template <typename A>
@@ -281,34 +311,45 @@ struct SmallVector : VectorBase
 
     void removeAt(int index)
     {
-        if (isStatic())
-            staticVec.removeAt(index);
-        else
-            dynamicVec.removeAt(index);
+        if (index < 0 || index >= size())
+            return;
+
+        auto* slot = elements + index;
+        slot->~T();
+        Relocation::relocateOverlapping(slot + 1, size() - index - 1, slot);
+        --finish;
     }
 
     template <typename Callable>
     bool eraseIf(Callable&& callable)
     {
-        bool erased = false;
-        auto last = getLastElementIndex();
+        auto* newEnd = std::remove_if(begin(), end(), callable);
+        auto erased = newEnd != finish;
 
-        for (int index = last; index >= 0; --index)
-        {
-            if (callable(get(index)))
-            {
-                removeAt(index);
-                erased = true;
-            }
-        }
+        destroyFrom(newEnd);
+        return erased;
+    }
+
+    //O(1) removal that moves the last element into index, so the order
+    //isn't kept
+    void swapRemove(int index) { Vectors::swapRemove(*this, index); }
+
+    //eraseIf() that fills the gaps from the end instead of shifting the rest
+    //down, so the order isn't kept
+    template <typename Callable>
+    bool unorderedEraseIf(Callable&& callable)
+    {
+        auto* newEnd = Vectors::unorderedRemoveIf(begin(), end(), callable);
+        auto erased = newEnd != finish;
 
+        destroyFrom(newEnd);
         return erased;
     }
 
     void pop_back()
     {
         if (!empty())
-            removeAt(getLastElementIndex());
+            destroyFrom(finish - 1);
     }
 
     int getLastElementIndex() const noexcept { return size() - 1; }
@@ -389,24 +430,98 @@ struct SmallVector : VectorBase
         std::copy_if(begin(), end(), std::back_inserter(other), predicate);
     }
 
-    const T* data() const
+    const T* data() const noexcept { return elements; }
+    T* data() noexcept { return elements; }
+
+private:
+    T* getInlineData() noexcept { return inlineStorage[0].get(); }
+    const T* getInlineData() const noexcept { return inlineStorage[0].get(); }
+
+    int getGrownCapacity(int sizeExtra) const noexcept
+    {
+        return std::max(size() + sizeExtra, capacity() * 2);
+    }
+
+    void moveToHeap(int newCapacity)
+    {
+        auto* block = Allocators::allocate<T>((size_t) newCapacity);
+        auto count = size();
+
+        Relocation::relocate(elements, count, block);
+        adoptHeap(block, count, newCapacity);
+    }
+
+    //The new element is created before the old ones move, as args may refer
+    //to one of them
+    template <typename... Args>
+    T& growAndCreate(Args&&... args)
+    {
+        auto newCapacity = getGrownCapacity(1);
+        auto count = size();
+        auto* block = Allocators::allocate<T>((size_t) newCapacity);
+        auto* element = new (block + count) T(std::forward<Args>(args)...);
+
+        Relocation::relocate(elements, count, block);
+        adoptHeap(block, count + 1, newCapacity);
+
+        return *element;
+    }
+
+    void adoptHeap(T* block, int count, int newCapacity) noexcept
+    {
+        freeHeap();
+        elements = block;
+        finish = block + count;
+        storageEnd = block + newCapacity;
+    }
+
+    //Expects the elements to be destroyed or moved out already
+    void freeHeap() noexcept
+    {
+        if (!isStatic())
+            Allocators::deallocate<T>(elements, (size_t) capacity());
+
+        elements = finish = getInlineData();
+        storageEnd = elements + PreAllocatedSize;
+    }
+
+    //Takes other's heap block, or moves its inline elements one by one.
+    //Expects this to be empty and inline.
+    void takeFrom(SmallVector& other) noexcept
     {
-        if (usingStatic)
-            return staticVec.data();
+        if (other.isStatic())
+        {
+            Relocation::relocate(other.elements, other.size(), elements);
+            finish = elements + other.size();
+            other.finish = other.elements;
+            return;
+        }
+
+        elements = other.elements;
+        finish = other.finish;
+        storageEnd = other.storageEnd;
 
-        return dynamicVec.data();
+        other.elements = other.finish = other.getInlineData();
+        other.storageEnd = other.elements + PreAllocatedSize;
     }
 
-    T* data()
+    //Destroys the elements from first on
+    void destroyFrom(T* first) noexcept
     {
-        if (usingStatic)
-            return staticVec.data();
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (auto* element = first; element != finish; ++element)
+                element->~T();
+        }
 
-        return dynamicVec.data();
+        finish = first;
     }
 
-    Vector<T> dynamicVec;
-    StaticVector<T, PreAllocatedSize> staticVec;
-    bool usingStatic = true;
+    //Declared first, so it's constructed before the pointers below aim at it
+    RawStorage<T> inlineStorage[PreAllocatedSize];
+
+    T* elements = getInlineData();
+    T* finish = elements;
+    T* storageEnd = elements + PreAllocatedSize;
 };
-} // namespace EA
\ No newline at end of file
+} // namespace EA
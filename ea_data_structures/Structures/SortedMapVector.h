@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Vector.h"
+#include <functional>
+#include "../Utilities/MapUtilities.h"
+
+/*A MapVector that keeps its elements ordered by key.
+
+Lookups (getValue, operator[], getOrCreate, remove) use a binary search
+and are O(log n), while iteration stays a plain walk over a contiguous vector.
+Inserting a single new key still shifts the elements after it, so when adding
+many keys at once prefer insertBatch(), which sorts the new elements and merges
+them in with a single pass.
+
+Keys are unique: emplace() and getOrCreate() return the existing value when
+the key is already there.
+*/
+namespace EA
+{
+template <typename KeyType,
+          typename ValueType,
+          typename Compare = std::less<KeyType>>
+struct SortedMapVector
+{
+    using key_type = KeyType;
+    using ElementType = MapUtils::Detail::KeyValuePair<KeyType, ValueType>;
+    using ContainerType = Vector<ElementType>;
+    using Iterator = typename ContainerType::Iterator;
+    using ConstIterator = typename ContainerType::Const_Iterator;
+
+    Iterator begin() { return container.begin(); }
+    Iterator end() { return container.end(); }
+
+    ConstIterator begin() const { return container.begin(); }
+    ConstIterator end() const { return container.end(); }
+
+    ConstIterator find(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return {begin() + index};
+
+        return end();
+    }
+
+    bool contains(const KeyType& key) const { return getIndexOf(key) >= 0; }
+
+    template <typename T>
+    const ValueType* getFirstMatch(const T& other) const
+    {
+        for (auto& element: container)
+        {
+            if (element.second == other)
+                return &element.second;
+        }
+
+        return nullptr;
+    }
+
+    template <typename T>
+    bool hasMatch(const T& other) const
+    {
+        return getFirstMatch(other) != nullptr;
+    }
+
+    const ValueType* getValue(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &container[index].second;
+
+        return nullptr;
+    }
+
+    ValueType* getValue(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &container[index].second;
+
+        return nullptr;
+    }
+
+    void remove(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            removeAt(index);
+    }
+
+    void removeAt(int index) { container.removeAt(index); }
+
+    template <typename Callable>
+    void eraseIf(Callable&& callable)
+    {
+        auto eraseFunc = [callable](const auto& pair)
+        { return callable(pair.second); };
+
+        container.eraseIf(eraseFunc);
+    }
+
+    template <typename... Args>
+    ValueType& emplace(const KeyType& key, Args&&... args)
+    {
+        auto index = getLowerBound(key);
+
+        if (isKeyAt(index, key))
+            return container[index].second;
+
+        return container.insertAt(index, key, std::forward<Args>(args)...).second;
+    }
+
+    ValueType& getOrCreate(const KeyType& key) { return emplace(key); }
+    ValueType& operator[](const KeyType& key) { return getOrCreate(key); }
+
+    //Adds a range of pairs (anything with .first/.second, like std::pair or
+    //KeyValuePair) in O(n + k log k): the new pairs are sorted on their own
+    //and then merged with the existing elements in a single pass.
+    //When a key appears more than once, the last value in the range wins, and
+    //it replaces the value already stored for that key.
+    template <typename Range>
+    void insertBatch(const Range& pairs)
+    {
+        auto batch = ContainerType();
+        batch.reserve((int) std::size(pairs));
+
+        for (auto& pair: pairs)
+            batch.create(pair.first, pair.second);
+
+        auto keyLess = [](const ElementType& first, const ElementType& second)
+        { return Compare()(first.first, second.first); };
+
+        batch.stableSort(keyLess);
+
+        auto merged = ContainerType();
+        merged.reserve(size() + batch.size());
+
+        auto existing = container.begin();
+
+        for (auto incoming = batch.begin(); incoming != batch.end(); ++incoming)
+        {
+            auto next = incoming + 1;
+
+            if (next != batch.end() && !keyLess(*incoming, *next))
+                continue;
+
+            while (existing != container.end() && keyLess(*existing, *incoming))
+                merged.add(std::move(*existing++));
+
+            if (existing != container.end() && !keyLess(*incoming, *existing))
+                ++existing;
+
+            merged.add(std::move(*incoming));
+        }
+
+        while (existing != container.end())
+            merged.add(std::move(*existing++));
+
+        container = std::move(merged);
+    }
+
+    void insertBatch(std::initializer_list<std::pair<KeyType, ValueType>> pairs)
+    {
+        insertBatch<std::initializer_list<std::pair<KeyType, ValueType>>>(pairs);
+    }
+
+    void clear() { container.clear(); }
+    void reserve(int numItems) { container.reserve(numItems); }
+
+    ValueType& get(int index) { return container[index].second; }
+    const KeyType& getKey(int index) { return container[index].first; }
+
+    template <typename Func>
+    const KeyType* getKeyBy(Func comparison) const
+    {
+        for (auto& element: container)
+        {
+            if (comparison(element.second))
+                return &element.first;
+        }
+
+        return nullptr;
+    }
+
+    const KeyType* getKeyByValue(const ValueType& value) const
+    {
+        auto comparison = [&](const ValueType& v) { return value == v; };
+        return getKeyBy(comparison);
+    }
+
+    ValueType& back() { return container.back().second; }
+    const ValueType& back() const { return container.back().second; }
+
+    ElementType& getPair(int index) { return container[index]; }
+
+    int size() const { return container.size(); }
+    bool empty() const { return container.empty(); }
+
+    int getIndexOf(const KeyType& key) const
+    {
+        auto index = getLowerBound(key);
+
+        if (isKeyAt(index, key))
+            return index;
+
+        return -1;
+    }
+
+    //The index of the first element whose key isn't ordered before key,
+    //which is also where key would be inserted
+    int getLowerBound(const KeyType& key) const
+    {
+        auto it = std::lower_bound(container.begin(),
+                                   container.end(),
+                                   key,
+                                   [](const ElementType& element, const KeyType& k)
+                                   { return Compare()(element.first, k); });
+
+        return (int) (it - container.begin());
+    }
+
+    ContainerType container;
+
+private:
+    bool isKeyAt(int index, const KeyType& key) const
+    {
+        return index < size() && !Compare()(key, container[index].first);
+    }
+};
+
+} // namespace EA
@@ -1,9 +1,23 @@
 #pragma once
 
+#include "../Allocators/DefaultInitAllocator.h"
 #include "../Allocators/SmallVectorAllocator.h"
 #include "../Allocators/StaticVectorAllocator.h"
 #include "Vector.h"
 
 namespace EA
 {
-}
+//A Vector whose resize() and size constructor don't zero trivial types, for
+//audio or network buffers that get written right after. Elements that are
+//classes are still default constructed.
+template <typename T, typename GrowthPolicy = Growth::Standard>
+using DefaultInitVector =
+    Vector<T, Allocators::DefaultInit::Allocator<T>, GrowthPolicy>;
+
+//A Vector that moves trivially relocatable elements (OwningPointer, Ref,
+//types that opt in to TriviallyRelocatable) with memcpy/memmove when it
+//grows, inserts or removes
+template <typename T, typename GrowthPolicy = Growth::Standard>
+using RelocatingVector =
+    Vector<T, std::allocator<T>, GrowthPolicy, VectorStorage::Relocating>;
+} // namespace EA
@@ -0,0 +1,284 @@
+#pragma once
+
+#include "../Flags/Bool.h"
+#include "Vector.h"
+#include <type_traits>
+
+/*A MapVector with a structure-of-arrays layout: keys and values live in two
+separate contiguous vectors that share indexes.
+
+Searching for a key only touches the key array, so large values don't get
+pulled into the cache during lookups, and for arithmetic keys the scan is
+written so the compiler can vectorize it.
+
+begin()/end() iterate over the values only (still contiguous). Use getKeys()
+to walk the keys, or getKey(index)/get(index) to walk both together.
+*/
+namespace EA
+{
+namespace Detail
+{
+//Compares whole blocks of keys without an early exit, which compilers turn
+//into SIMD compares, and only looks for the exact index in a matching block
+template <typename KeyType>
+int findArithmeticKey(const KeyType* keys, int size, KeyType key) noexcept
+{
+    constexpr int blockSize = 16;
+
+    int start = 0;
+
+    for (; start + blockSize <= size; start += blockSize)
+    {
+        auto matches = 0;
+
+        for (int index = 0; index < blockSize; ++index)
+            matches |= (int) (keys[start + index] == key);
+
+        if (matches != 0)
+            break;
+    }
+
+    for (int index = start; index < size; ++index)
+    {
+        if (keys[index] == key)
+            return index;
+    }
+
+    return -1;
+}
+
+//std::vector<bool> packs its elements into bits, so bool keys are kept as
+//Bool, which can be referenced like any other key
+template <typename KeyType>
+using SplitMapKey =
+    std::conditional_t<std::is_same_v<KeyType, bool>, Bool, KeyType>;
+} // namespace Detail
+
+template <typename KeyType, typename ValueType>
+struct SplitMapVector
+{
+    using key_type = KeyType;
+    using KeyContainerType = Vector<Detail::SplitMapKey<KeyType>>;
+    using ContainerType = Vector<ValueType>;
+    using Iterator = typename ContainerType::Iterator;
+    using ConstIterator = typename ContainerType::Const_Iterator;
+
+    Iterator begin() { return values.begin(); }
+    Iterator end() { return values.end(); }
+
+    ConstIterator begin() const { return values.begin(); }
+    ConstIterator end() const { return values.end(); }
+
+    ConstIterator find(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return {begin() + index};
+
+        return end();
+    }
+
+    bool contains(const KeyType& key) const { return getIndexOf(key) >= 0; }
+
+    template <typename T>
+    const ValueType* getFirstMatch(const T& other) const
+    {
+        auto index = values.getIndexOf(other);
+
+        if (index >= 0)
+            return &values[index];
+
+        return nullptr;
+    }
+
+    template <typename T>
+    bool hasMatch(const T& other) const
+    {
+        return getFirstMatch(other) != nullptr;
+    }
+
+    const ValueType* getValue(const KeyType& key) const
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &values[index];
+
+        return nullptr;
+    }
+
+    ValueType* getValue(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            return &values[index];
+
+        return nullptr;
+    }
+
+    void remove(const KeyType& key)
+    {
+        auto index = getIndexOf(key);
+
+        if (index >= 0)
+            removeAt(index);
+    }
+
+    void removeAt(int index)
+    {
+        keys.removeAt(index);
+        values.removeAt(index);
+    }
+
+    //Removes every element whose value matches the callable, compacting
+    //both arrays in a single pass
+    template <typename Callable>
+    void eraseIf(Callable&& callable)
+    {
+        int target = 0;
+
+        for (int index = 0; index < size(); ++index)
+        {
+            if (callable(values[index]))
+                continue;
+
+            if (target != index)
+            {
+                keys[target] = std::move(keys[index]);
+                values[target] = std::move(values[index]);
+            }
+
+            ++target;
+        }
+
+        keys.erase(keys.begin() + target, keys.end());
+        values.erase(values.begin() + target, values.end());
+    }
+
+    ValueType& getOrCreate(const KeyType& key)
+    {
+        if (auto* value = getValue(key))
+            return *value;
+
+        return emplace(key);
+    }
+
+    ValueType& operator[](const KeyType& key) { return getOrCreate(key); }
+
+    void clear()
+    {
+        keys.clear();
+        values.clear();
+    }
+
+    void reserve(int numItems)
+    {
+        keys.reserve(numItems);
+        values.reserve(numItems);
+    }
+
+    template <typename... Args>
+    ValueType& emplace(const KeyType& key, Args&&... args)
+    {
+        keys.add(key);
+        return values.create(std::forward<Args>(args)...);
+    }
+
+    ValueType& get(int index) { return values[index]; }
+    const ValueType& get(int index) const { return values[index]; }
+
+    const KeyType& getKey(int index) const { return getKeyOf(keys[index]); }
+
+    template <typename Func>
+    const KeyType* getKeyBy(Func comparison) const
+    {
+        for (int index = 0; index < size(); ++index)
+        {
+            if (comparison(values[index]))
+                return &getKeyOf(keys[index]);
+        }
+
+        return nullptr;
+    }
+
+    const KeyType* getKeyByValue(const ValueType& value) const
+    {
+        auto comparison = [&](const ValueType& v) { return value == v; };
+        return getKeyBy(comparison);
+    }
+
+    ValueType& back() { return values.back(); }
+    const ValueType& back() const { return values.back(); }
+
+    int size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+
+    void sortByKey(bool forward = true)
+    {
+        sortBy([this](int first, int second)
+               { return keys[first] < keys[second]; },
+               forward);
+    }
+
+    void sortByValue(bool forward = true)
+    {
+        sortBy([this](int first, int second)
+               { return values[first] < values[second]; },
+               forward);
+    }
+
+    int getIndexOf(const KeyType& key) const
+    {
+        //bool keys are stored as Bool, so they take the plain search
+        if constexpr (std::is_arithmetic_v<KeyType>
+                      && !std::is_same_v<KeyType, bool>)
+            return Detail::findArithmeticKey(keys.data(), keys.size(), key);
+        else
+            return keys.getIndexOf(Detail::SplitMapKey<KeyType>(key));
+    }
+
+    const KeyContainerType& getKeys() const { return keys; }
+    const ContainerType& getValues() const { return values; }
+
+private:
+    static const KeyType& getKeyOf(const Detail::SplitMapKey<KeyType>& key)
+    {
+        if constexpr (std::is_same_v<KeyType, bool>)
+            return key.value;
+        else
+            return key;
+    }
+
+    //Sorts a permutation of indexes and then applies it to both arrays
+    template <typename Compare>
+    void sortBy(Compare compare, bool forward)
+    {
+        auto order = Vector<int>(size());
+
+        for (int index = 0; index < size(); ++index)
+            order[index] = index;
+
+        order.stableSort(compare, forward);
+
+        auto sortedKeys = KeyContainerType();
+        auto sortedValues = ContainerType();
+        sortedKeys.reserve(size());
+        sortedValues.reserve(size());
+
+        for (auto index: order)
+        {
+            sortedKeys.add(std::move(keys[index]));
+            sortedValues.add(std::move(values[index]));
+        }
+
+        keys = std::move(sortedKeys);
+        values = std::move(sortedValues);
+    }
+
+    KeyContainerType keys;
+    ContainerType values;
+};
+
+} // namespace EA
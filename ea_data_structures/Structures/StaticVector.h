@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../ValueWrapper/Constructed.h"
+#include "../ValueWrapper/Relocation.h"
 #include "Vector.h"
 
 namespace EA
@@ -44,14 +45,24 @@ struct StaticVector : VectorBase
     bool empty() const noexcept { return currentSize == 0; }
     int size() const noexcept { return currentSize; }
 
+    //Like add(), a no-op when full
     void insert(int position, const T& object)
     {
-        if (currentSize < MaxSize)
+        if (currentSize >= MaxSize)
+            return;
+
+        if (position >= currentSize)
         {
-            std::rotate(begin() + position, container.end() - 1, container.end());
-            container[position] = object;
-            ++currentSize;
+            add(object);
+            return;
         }
+
+        auto item = T(object);
+        auto* slot = data() + position;
+
+        Relocation::relocateOverlapping(slot, currentSize - position, slot + 1);
+        new (slot) T(std::move(item));
+        ++currentSize;
     }
 
     T& back() { return get(getLastElementIndex()); }
@@ -147,18 +158,10 @@ struct StaticVector : VectorBase
     template <typename A>
     int removeAllMatches(const A& element)
     {
-        int removedElements = 0;
-
-        for (int index = getLastElementIndex(); index >= 0; --index)
-        {
-            if (get(index) == element)
-            {
-                ++removedElements;
-                removeAt(index);
-            }
-        }
+        auto previousSize = currentSize;
+        eraseIf([&element](const T& item) { return item == element; });
 
-        return removedElements;
+        return previousSize - currentSize;
     }
 
     void resize(size_t numElements) { resize((int) numElements); }
@@ -236,20 +239,35 @@ struct StaticVector : VectorBase
     template <typename A>
     void mixFrom(A& other)
     {
-        for (int index = 0; index < size(); ++index)
-            get(index) += other[index];
+        if constexpr (SIMD::ContiguousOf<A, T>)
+            SIMD::mix(data(), other.data(), size());
+        else
+        {
+            for (int index = 0; index < size(); ++index)
+                get(index) += other[index];
+        }
     }
 
     void fill(const T& value)
     {
-        for (auto& element: *this)
-            element = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, size());
+        else
+        {
+            for (auto& element: *this)
+                element = value;
+        }
     }
 
     void fill(const T& value, int numItems)
     {
-        for (int index = 0; index < numItems; ++index)
-            get(index) = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, numItems);
+        else
+        {
+            for (int index = 0; index < numItems; ++index)
+                get(index) = value;
+        }
     }
 
     template <typename A>
@@ -281,41 +299,54 @@ struct StaticVector : VectorBase
 
     void removeAt(int index)
     {
-        if (currentSize >= 1 && index >= 0 && index < currentSize)
+        if (index >= 0 && index < currentSize)
         {
-            for (int elementIndex = index; elementIndex < size(); ++elementIndex)
-            {
-                container[elementIndex].destroy();
-
-                if (elementIndex < getLastElementIndex())
-                {
-                    container[elementIndex].create(
-                        std::move(container[elementIndex + 1].object));
-                }
-            }
+            auto* slot = data() + index;
+            slot->~T();
 
+            Relocation::relocateOverlapping(slot + 1, currentSize - index - 1, slot);
             --currentSize;
         }
     }
 
+    //Removes the matches in one pass, keeping the order of the rest
     template <typename Callable>
     bool eraseIf(Callable&& callable)
     {
-        bool erased = false;
-        auto last = getLastElementIndex();
+        auto newEnd = std::remove_if(begin(), end(), callable);
+        auto erased = newEnd != end();
 
-        for (int index = last; index >= 0; --index)
-        {
-            if (callable(get(index)))
-            {
-                removeAt(index);
-                erased = true;
-            }
-        }
+        destroyFrom(newEnd);
+        return erased;
+    }
+
+    //O(1) removal that moves the last element into index, so the order
+    //isn't kept
+    void swapRemove(int index) { Vectors::swapRemove(*this, index); }
 
+    //eraseIf() that fills the gaps from the end instead of shifting the rest
+    //down, so the order isn't kept
+    template <typename Callable>
+    bool unorderedEraseIf(Callable&& callable)
+    {
+        auto newEnd = Vectors::unorderedRemoveIf(begin(), end(), callable);
+        auto erased = newEnd != end();
+
+        destroyFrom(newEnd);
         return erased;
     }
 
+    //Destroys the elements from first on
+    void destroyFrom(Iterator first) noexcept
+    {
+        auto newSize = int(first - begin());
+
+        for (int index = newSize; index < currentSize; ++index)
+            container[index].destroy();
+
+        currentSize = newSize;
+    }
+
     void pop_back()
     {
         if (!empty())
@@ -384,8 +415,7 @@ struct StaticVector : VectorBase
     template <typename Predicate>
     StaticVector& filterInPlace(Predicate&& predicate)
     {
-        auto removed = std::remove_if(begin(), end(), predicate);
-        resize(removed - begin());
+        destroyFrom(std::remove_if(begin(), end(), predicate));
         return *this;
     }
 
@@ -2,8 +2,11 @@
 
 #include <vector>
 #include <iterator>
+#include "RelocatingBuffer.h"
 #include "SizeType.h"
+#include "../Allocators/DefaultInitAllocator.h"
 #include "../Utilities/VectorUtilities.h"
+#include "../Utilities/SIMD.h"
 
 namespace EA
 {
@@ -18,15 +21,76 @@ constexpr bool isVector()
     return std::is_base_of_v<VectorBase, T>;
 }
 
+//Growth policies: how much capacity to reserve when a Vector needs at
+//least `required` elements and has `current`
+namespace Growth
+{
+//Doubles in reserveAtLeast(), and leaves appending to std::vector's own
+//geometric growth
+struct Standard
+{
+    static int getCapacity(int current, int required) noexcept
+    {
+        return std::max(required, current * 2);
+    }
+};
+
+//Grows by Numerator / Denominator, e.g. Factor<3, 2> for 1.5x, which uses
+//less memory and lets the allocator reuse freed blocks
+template <int Numerator, int Denominator = 1>
+struct Factor
+{
+    static_assert(Numerator > Denominator, "The growth factor has to be above 1");
+
+    static int getCapacity(int current, int required) noexcept
+    {
+        return std::max({required, current * Numerator / Denominator, current + 1});
+    }
+};
+
+//Only what's asked for, for vectors that are sized up front.
+//Appending one item at a time reallocates every time.
+struct Exact
+{
+    static int getCapacity(int, int required) noexcept { return required; }
+};
+} // namespace Growth
+
+//What a Vector keeps its elements in
+namespace VectorStorage
+{
+//std::vector, the default
+struct Standard
+{
+    template <typename T, typename Allocator>
+    using Type = std::vector<T, Allocator>;
+};
+
+//RelocatingBuffer, which grows, inserts and erases trivially relocatable
+//elements with memcpy/memmove. getVector() returns the buffer instead of a
+//std::vector.
+struct Relocating
+{
+    template <typename T, typename Allocator>
+    using Type = RelocatingBuffer<T, Allocator>;
+};
+} // namespace VectorStorage
+
 //A std::vector wrapper with int-based indexing and sizes (instead of size_t)
 //plus a set of helpers (contains, addIfNotThere, eraseIf, sort, reverse,
 //transform, filter, getIndexOf, …) that are commonly needed in application
 //code. Element type, allocator, and iteration match std::vector semantics.
-template <typename T, typename Allocator = std::allocator<T>>
+//GrowthPolicy decides reserveAtLeast(), and unless it's Growth::Standard,
+//how add() and create() grow a full vector. Storage picks the container
+//underneath (see VectorStorage).
+template <typename T,
+          typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = Growth::Standard,
+          typename Storage = VectorStorage::Standard>
 class Vector : VectorBase
 {
 public:
-    using ContainerType = std::vector<T, Allocator>;
+    using ContainerType = typename Storage::template Type<T, Allocator>;
     using size_type = int;
     using Iterator = typename ContainerType::iterator;
     using Const_Iterator = typename ContainerType::const_iterator;
@@ -57,10 +121,12 @@ public:
     int capacity() const { return (int) container.capacity(); }
     void reserve(SizeType capacity) { container.reserve(capacity); }
 
+    //Grows by the growth policy, so calling it before each batch of adds
+    //doesn't reallocate every time
     void reserveAtLeast(int capacityToUse)
     {
         if (capacity() < capacityToUse)
-            reserve(capacityToUse);
+            reserve(GrowthPolicy::getCapacity(capacity(), capacityToUse));
     }
 
     Vector& operator=(const Vector& other)
@@ -130,11 +196,7 @@ public:
     const T& front() const { return container.front(); }
     T& front() { return container.front(); }
 
-    T& add(const T& elementToAdd) noexcept
-    {
-        container.push_back(elementToAdd);
-        return back();
-    }
+    T& add(const T& elementToAdd) noexcept { return create(elementToAdd); }
 
     T& push_back(const T& elementToAdd) noexcept { return add(elementToAdd); }
 
@@ -150,11 +212,7 @@ public:
         container.erase(first, last);
     }
 
-    T& add(T&& elementToAdd) noexcept
-    {
-        container.push_back(std::move(elementToAdd));
-        return back();
-    }
+    T& add(T&& elementToAdd) noexcept { return create(std::move(elementToAdd)); }
 
     void add(std::initializer_list<T> items) noexcept
     {
@@ -165,6 +223,19 @@ public:
     template <typename... Args>
     T& create(Args&&... args)
     {
+        if constexpr (!std::is_same_v<GrowthPolicy, Growth::Standard>)
+        {
+            if (container.size() == container.capacity())
+            {
+                //args may refer to an element, so it's built before growing
+                auto element = T(std::forward<Args>(args)...);
+                reserve(GrowthPolicy::getCapacity(capacity(), size() + 1));
+                container.push_back(std::move(element));
+
+                return back();
+            }
+        }
+
         container.emplace_back(std::forward<Args>(args)...);
         return back();
     }
@@ -252,6 +323,25 @@ public:
 
     void resize(SizeType numElements) { container.resize(numElements); }
 
+    //Grows without value-initializing the new elements, so trivial types
+    //aren't zeroed. Needs an allocator that default-initializes (see
+    //DefaultInitVector), where resize() does the same.
+    void resizeDefaultInit(SizeType numElements)
+    {
+        static_assert(Allocators::isDefaultInit<Allocator>(),
+                      "Needs Allocators::DefaultInit::Allocator");
+        container.resize(numElements);
+    }
+
+    //resizeDefaultInit() for trivial types: the new elements hold garbage
+    //until they're written
+    void resizeUninitialized(SizeType numElements)
+    {
+        static_assert(std::is_trivially_default_constructible_v<T>,
+                      "Only trivial types can be left uninitialized");
+        resizeDefaultInit(numElements);
+    }
+
     template <typename FloatType>
     FloatType getIndexAsRelative(int index) const
     {
@@ -288,8 +378,7 @@ public:
     template <typename Callable>
     void removeIndexesMatching(Callable&& func)
     {
-        auto indexes = getIndexesMatching(func);
-        removeIndexes(indexes);
+        eraseIf(func);
     }
 
     template <typename FloatType>
@@ -325,29 +414,42 @@ public:
     template <typename A>
     void mixFrom(A& other)
     {
-        for (int index = 0; index < size(); ++index)
-            container[index] += other[index];
+        if constexpr (SIMD::ContiguousOf<A, T>)
+            SIMD::mix(data(), other.data(), size());
+        else
+        {
+            for (int index = 0; index < size(); ++index)
+                container[index] += other[index];
+        }
     }
 
     void fill(const T& value)
     {
-        for (auto& element: container)
-            element = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, size());
+        else
+        {
+            for (auto& element: container)
+                element = value;
+        }
     }
 
     void fill(const T& value, int numItems)
     {
-        for (int index = 0; index < numItems; ++index)
-            get(index) = value;
+        if constexpr (SIMD::isArithmetic<T>())
+            SIMD::fill(data(), value, numItems);
+        else
+        {
+            for (int index = 0; index < numItems; ++index)
+                get(index) = value;
+        }
     }
 
     template <typename A>
     void addFrom(const A& other)
     {
         reserveAtLeast(size() + other.size());
-
-        for (auto& element: other)
-            container.push_back(element);
+        container.insert(container.end(), other.begin(), other.end());
     }
 
     template <typename A>
@@ -371,13 +473,11 @@ public:
 
     void removeAt(int index) { Vectors::removeAt(container, index); }
 
+    //Removes all of them in one pass. Sorts indexes if they aren't sorted.
     template <typename A>
-    void removeIndexes(A& indexes)
+    int removeIndexes(A& indexes)
     {
-        indexes.sort(false);
-
-        for (auto i: indexes)
-            removeAt(i);
+        return Vectors::removeIndexes(container, indexes);
     }
 
     template <typename Callable>
@@ -386,6 +486,18 @@ public:
         return Vectors::eraseIf(container, callable);
     }
 
+    //O(1) removal that moves the last element into index, so the order
+    //isn't kept
+    void swapRemove(int index) { Vectors::swapRemove(container, index); }
+
+    //eraseIf() that fills the gaps from the end instead of shifting the rest
+    //down, so the order isn't kept
+    template <typename Callable>
+    bool unorderedEraseIf(Callable&& callable)
+    {
+        return Vectors::unorderedEraseIf(container, callable);
+    }
+
     void pop_back()
     {
         if (!empty())
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ThreadPool.h"
+#include <type_traits>
+
+//Execution policies for the Vectors algorithms, in the spirit of
+//std::execution, but run on EA::ThreadPool so they work the same with every
+//standard library:
+//
+//Vectors::sort(Execution::par, vec);
+namespace EA::Execution
+{
+//Empty base class to allow checking for a policy
+struct PolicyBase
+{
+};
+
+//Runs on the calling thread, same as the overloads without a policy
+struct Sequenced : PolicyBase
+{
+};
+
+//Splits the work over a ThreadPool (the default one unless pool is set) for
+//containers of at least minParallelSize elements, and runs serially below
+//that. Functions passed to the algorithms may be called from several threads
+//at once, and must not throw.
+struct Parallel : PolicyBase
+{
+    ThreadPool& getPool() const
+    {
+        return pool != nullptr ? *pool : ThreadPool::getDefault();
+    }
+
+    int minParallelSize = 1 << 15;
+    ThreadPool* pool = nullptr;
+};
+
+//Also allows vectorizing within a thread. Each thread runs the serial
+//algorithms on its part, which the compiler vectorizes where it can, so in
+//practice this is the same as Parallel.
+struct ParallelUnsequenced : Parallel
+{
+};
+
+inline constexpr Sequenced seq {};
+inline constexpr Parallel par {};
+inline constexpr ParallelUnsequenced parUnseq {};
+
+template <typename T>
+concept Policy = std::is_base_of_v<PolicyBase, std::remove_cvref_t<T>>;
+
+template <typename T>
+constexpr bool isParallel()
+{
+    return std::is_base_of_v<Parallel, std::remove_cvref_t<T>>;
+}
+} // namespace EA::Execution
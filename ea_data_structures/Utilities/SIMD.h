@@ -0,0 +1,1231 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+/*Vectorized kernels for the per-block loops of audio code over raw buffers:
+mixing, gains and gain ramps, multiplying, peak/min/max/RMS measurements and
+interleaving channels.
+
+For float and double the kernels use 128 bit SIMD (SSE2 on x86, NEON on
+AArch64), and on x86 switch at runtime to AVX2/FMA versions when the CPU
+supports them. The check is done once and cached. Other arithmetic types, and
+platforms without SIMD, use plain pointer loops, which compilers vectorize on
+their own. fill() is a plain std::fill_n for every type.
+
+Define EA_SIMD_DISABLE to always use the scalar loops.
+*/
+
+#if !defined(EA_SIMD_DISABLE)
+    #if defined(__SSE2__) || defined(_M_X64) \
+        || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define EA_SIMD_SSE2 1
+        #define EA_SIMD_AVX2 1
+        #include <immintrin.h>
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define EA_SIMD_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#if defined(EA_SIMD_AVX2)
+    #if defined(__GNUC__) || defined(__clang__)
+        #define EA_SIMD_AVX2_TARGET __attribute__((target("avx2,fma")))
+    #else
+        #define EA_SIMD_AVX2_TARGET
+    #endif
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+namespace EA::SIMD
+{
+//True for the element types that have dedicated SIMD kernels
+template <typename T>
+constexpr bool isAccelerated()
+{
+    return std::is_same_v<T, float> || std::is_same_v<T, double>;
+}
+
+//The element types the containers hand to these kernels. bool is left out,
+//since std::vector<bool> (and so Vector<bool>) has no data()
+template <typename T>
+constexpr bool isArithmetic()
+{
+    return std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+}
+
+//A container whose data() points to contiguous elements of exactly type T
+template <typename Container, typename T>
+concept ContiguousOf = isArithmetic<T>() && requires(Container& container) {
+    {
+        container.data()
+    } -> std::convertible_to<const T*>;
+    requires std::is_same_v<std::remove_cvref_t<decltype(*container.data())>, T>;
+};
+
+//The smallest and largest element of a buffer
+template <typename T>
+struct MinMax
+{
+    T min {};
+    T max {};
+};
+
+namespace Scalar
+{
+template <typename T>
+void mix(T* dest, const T* source, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] += source[index];
+}
+
+template <typename T>
+void mixWithGain(T* dest, const T* source, T gain, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] += source[index] * gain;
+}
+
+template <typename T>
+void fill(T* dest, T value, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] = value;
+}
+
+template <typename T>
+void scale(T* dest, T gain, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] *= gain;
+}
+
+template <typename T>
+void multiplyAdd(T* dest, const T* first, const T* second, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] += first[index] * second[index];
+}
+
+template <typename T>
+void multiply(T* dest, const T* source, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] *= source[index];
+}
+
+template <typename T>
+void applyGainRamp(T* dest, T startGain, T step, int size) noexcept
+{
+    for (int index = 0; index < size; ++index)
+        dest[index] *= startGain + step * (T) index;
+}
+
+template <typename T>
+T sumOfSquares(const T* source, int size) noexcept
+{
+    auto sum = T(0);
+
+    for (int index = 0; index < size; ++index)
+        sum += source[index] * source[index];
+
+    return sum;
+}
+
+template <typename T>
+MinMax<T> findMinMax(const T* source, int size) noexcept
+{
+    if (size <= 0)
+        return {};
+
+    auto result = MinMax<T> {source[0], source[0]};
+
+    for (int index = 1; index < size; ++index)
+    {
+        result.min = std::min(result.min, source[index]);
+        result.max = std::max(result.max, source[index]);
+    }
+
+    return result;
+}
+
+template <typename T>
+T findPeak(const T* source, int size) noexcept
+{
+    auto peak = T(0);
+
+    for (int index = 0; index < size; ++index)
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            auto value = source[index];
+            peak = std::max(peak, value < T(0) ? -value : value);
+        }
+        else
+            peak = std::max(peak, source[index]);
+    }
+
+    return peak;
+}
+
+//Channel by channel, so each source is read sequentially
+template <typename T>
+void interleave(T* dest,
+                const T* const* sources,
+                int numChannels,
+                int size) noexcept
+{
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        for (int index = 0; index < size; ++index)
+            dest[index * numChannels + channel] = sources[channel][index];
+    }
+}
+
+template <typename T>
+void deinterleave(T* const* dests,
+                  const T* source,
+                  int numChannels,
+                  int size) noexcept
+{
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        for (int index = 0; index < size; ++index)
+            dests[channel][index] = source[index * numChannels + channel];
+    }
+}
+} // namespace Scalar
+
+namespace Detail
+{
+//Each backend describes one register type through a "Batch" struct with
+//load/store/broadcast/add/multiply/multiplyAdd/min/max/abs. The kernels below
+//are written once against that interface and finish the remainder with the
+//scalar loops.
+template <typename Batch, typename T>
+inline void mix(T* dest, const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto sum =
+            Batch::add(Batch::load(dest + index), Batch::load(source + index));
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::mix(dest + index, source + index, size - index);
+}
+
+template <typename Batch, typename T>
+inline void mixWithGain(T* dest, const T* source, T gain, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto gains = Batch::broadcast(gain);
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto sum = Batch::multiplyAdd(
+            Batch::load(dest + index), Batch::load(source + index), gains);
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::mixWithGain(dest + index, source + index, gain, size - index);
+}
+
+template <typename Batch, typename T>
+inline void scale(T* dest, T gain, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto gains = Batch::broadcast(gain);
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto scaled = Batch::multiply(Batch::load(dest + index), gains);
+        Batch::store(dest + index, scaled);
+    }
+
+    Scalar::scale(dest + index, gain, size - index);
+}
+
+template <typename Batch, typename T>
+inline void multiplyAdd(T* dest, const T* first, const T* second, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto sum = Batch::multiplyAdd(Batch::load(dest + index),
+                                      Batch::load(first + index),
+                                      Batch::load(second + index));
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::multiplyAdd(dest + index, first + index, second + index, size - index);
+}
+
+template <typename Batch, typename T>
+inline void multiply(T* dest, const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto product =
+            Batch::multiply(Batch::load(dest + index), Batch::load(source + index));
+        Batch::store(dest + index, product);
+    }
+
+    Scalar::multiply(dest + index, source + index, size - index);
+}
+
+//Every gain is computed from the start rather than accumulated, so long
+//ramps don't drift
+template <typename Batch, typename T>
+inline void applyGainRamp(T* dest, T startGain, T step, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto starts = Batch::broadcast(startGain);
+    auto steps = Batch::broadcast(step);
+    auto lanes = Batch::laneIndexes();
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto positions = Batch::add(Batch::broadcast((T) index), lanes);
+        auto gains = Batch::multiplyAdd(starts, positions, steps);
+        auto ramped = Batch::multiply(Batch::load(dest + index), gains);
+        Batch::store(dest + index, ramped);
+    }
+
+    auto gain = startGain + step * (T) index;
+    Scalar::applyGainRamp(dest + index, gain, step, size - index);
+}
+
+template <typename Batch, typename T>
+inline T sumOfSquares(const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto sums = Batch::broadcast(T(0));
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto values = Batch::load(source + index);
+        sums = Batch::multiplyAdd(sums, values, values);
+    }
+
+    T lanes[width] {};
+    Batch::store(lanes, sums);
+
+    auto sum = Scalar::sumOfSquares(source + index, size - index);
+
+    for (auto lane: lanes)
+        sum += lane;
+
+    return sum;
+}
+
+template <typename Batch, typename T>
+inline MinMax<T> findMinMax(const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+
+    if (size < width)
+        return Scalar::findMinMax(source, size);
+
+    auto minimums = Batch::load(source);
+    auto maximums = minimums;
+    auto index = width;
+
+    for (; index + width <= size; index += width)
+    {
+        auto values = Batch::load(source + index);
+        minimums = Batch::min(minimums, values);
+        maximums = Batch::max(maximums, values);
+    }
+
+    T lowest[width] {};
+    T highest[width] {};
+    Batch::store(lowest, minimums);
+    Batch::store(highest, maximums);
+
+    auto result = MinMax<T> {lowest[0], highest[0]};
+
+    for (int lane = 1; lane < width; ++lane)
+    {
+        result.min = std::min(result.min, lowest[lane]);
+        result.max = std::max(result.max, highest[lane]);
+    }
+
+    for (; index < size; ++index)
+    {
+        result.min = std::min(result.min, source[index]);
+        result.max = std::max(result.max, source[index]);
+    }
+
+    return result;
+}
+
+template <typename Batch, typename T>
+inline T findPeak(const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto peaks = Batch::broadcast(T(0));
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+        peaks = Batch::max(peaks, Batch::abs(Batch::load(source + index)));
+
+    T lanes[width] {};
+    Batch::store(lanes, peaks);
+
+    auto peak = Scalar::findPeak(source + index, size - index);
+
+    for (auto lane: lanes)
+        peak = std::max(peak, lane);
+
+    return peak;
+}
+
+//Stereo only: two registers of left and right samples become two registers
+//of interleaved pairs, and back
+template <typename Batch, typename T>
+inline void interleave2(T* dest, const T* left, const T* right, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto first = Batch::load(left + index);
+        auto second = Batch::load(right + index);
+        auto* pairs = dest + index * 2;
+
+        Batch::store(pairs, Batch::interleaveLow(first, second));
+        Batch::store(pairs + width, Batch::interleaveHigh(first, second));
+    }
+
+    const T* rest[] = {left + index, right + index};
+    Scalar::interleave(dest + index * 2, rest, 2, size - index);
+}
+
+template <typename Batch, typename T>
+inline void deinterleave2(T* left, T* right, const T* source, int size) noexcept
+{
+    constexpr int width = Batch::width;
+    auto index = 0;
+
+    for (; index + width <= size; index += width)
+    {
+        auto low = Batch::load(source + index * 2);
+        auto high = Batch::load(source + index * 2 + width);
+
+        Batch::store(left + index, Batch::evenLanes(low, high));
+        Batch::store(right + index, Batch::oddLanes(low, high));
+    }
+
+    T* rest[] = {left + index, right + index};
+    Scalar::deinterleave(rest, source + index * 2, 2, size - index);
+}
+
+template <typename T>
+struct Batch128;
+
+#if defined(EA_SIMD_SSE2)
+template <>
+struct Batch128<float>
+{
+    using Register = __m128;
+    static constexpr int width = 4;
+
+    static Register load(const float* source) { return _mm_loadu_ps(source); }
+    static void store(float* dest, Register value) { _mm_storeu_ps(dest, value); }
+    static Register broadcast(float value) { return _mm_set1_ps(value); }
+    static Register add(Register a, Register b) { return _mm_add_ps(a, b); }
+    static Register multiply(Register a, Register b) { return _mm_mul_ps(a, b); }
+
+    //a + b * c
+    static Register multiplyAdd(Register a, Register b, Register c)
+    {
+        return _mm_add_ps(a, _mm_mul_ps(b, c));
+    }
+
+    static Register min(Register a, Register b) { return _mm_min_ps(a, b); }
+    static Register max(Register a, Register b) { return _mm_max_ps(a, b); }
+    static Register abs(Register a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    static Register laneIndexes() { return _mm_setr_ps(0.f, 1.f, 2.f, 3.f); }
+
+    //{a0, b0, a1, b1} and {a2, b2, a3, b3}
+    static Register interleaveLow(Register a, Register b)
+    {
+        return _mm_unpacklo_ps(a, b);
+    }
+
+    static Register interleaveHigh(Register a, Register b)
+    {
+        return _mm_unpackhi_ps(a, b);
+    }
+
+    //{a0, a2, b0, b2} and {a1, a3, b1, b3}
+    static Register evenLanes(Register a, Register b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    static Register oddLanes(Register a, Register b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
+
+template <>
+struct Batch128<double>
+{
+    using Register = __m128d;
+    static constexpr int width = 2;
+
+    static Register load(const double* source) { return _mm_loadu_pd(source); }
+    static void store(double* dest, Register value) { _mm_storeu_pd(dest, value); }
+    static Register broadcast(double value) { return _mm_set1_pd(value); }
+    static Register add(Register a, Register b) { return _mm_add_pd(a, b); }
+    static Register multiply(Register a, Register b) { return _mm_mul_pd(a, b); }
+
+    static Register multiplyAdd(Register a, Register b, Register c)
+    {
+        return _mm_add_pd(a, _mm_mul_pd(b, c));
+    }
+
+    static Register min(Register a, Register b) { return _mm_min_pd(a, b); }
+    static Register max(Register a, Register b) { return _mm_max_pd(a, b); }
+    static Register abs(Register a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static Register laneIndexes() { return _mm_setr_pd(0.0, 1.0); }
+
+    static Register interleaveLow(Register a, Register b)
+    {
+        return _mm_unpacklo_pd(a, b);
+    }
+
+    static Register interleaveHigh(Register a, Register b)
+    {
+        return _mm_unpackhi_pd(a, b);
+    }
+
+    static Register evenLanes(Register a, Register b)
+    {
+        return _mm_unpacklo_pd(a, b);
+    }
+
+    static Register oddLanes(Register a, Register b)
+    {
+        return _mm_unpackhi_pd(a, b);
+    }
+};
+
+//The AVX2 batches are compiled for AVX2/FMA regardless of the compiler flags,
+//and only ever called after the runtime check below
+template <typename T>
+struct Batch256;
+
+template <>
+struct Batch256<float>
+{
+    using Register = __m256;
+    static constexpr int width = 8;
+
+    EA_SIMD_AVX2_TARGET static Register load(const float* source)
+    {
+        return _mm256_loadu_ps(source);
+    }
+
+    EA_SIMD_AVX2_TARGET static void store(float* dest, Register value)
+    {
+        _mm256_storeu_ps(dest, value);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register broadcast(float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register add(Register a, Register b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register multiply(Register a, Register b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register
+        multiplyAdd(Register a, Register b, Register c)
+    {
+        return _mm256_fmadd_ps(b, c, a);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register min(Register a, Register b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register max(Register a, Register b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register abs(Register a)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register laneIndexes()
+    {
+        return _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+    }
+};
+
+template <>
+struct Batch256<double>
+{
+    using Register = __m256d;
+    static constexpr int width = 4;
+
+    EA_SIMD_AVX2_TARGET static Register load(const double* source)
+    {
+        return _mm256_loadu_pd(source);
+    }
+
+    EA_SIMD_AVX2_TARGET static void store(double* dest, Register value)
+    {
+        _mm256_storeu_pd(dest, value);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register broadcast(double value)
+    {
+        return _mm256_set1_pd(value);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register add(Register a, Register b)
+    {
+        return _mm256_add_pd(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register multiply(Register a, Register b)
+    {
+        return _mm256_mul_pd(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register
+        multiplyAdd(Register a, Register b, Register c)
+    {
+        return _mm256_fmadd_pd(b, c, a);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register min(Register a, Register b)
+    {
+        return _mm256_min_pd(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register max(Register a, Register b)
+    {
+        return _mm256_max_pd(a, b);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register abs(Register a)
+    {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+    }
+
+    EA_SIMD_AVX2_TARGET static Register laneIndexes()
+    {
+        return _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    }
+};
+
+//The AVX2 kernels repeat the generic ones above: everything that touches a
+//256 bit register has to be compiled for AVX2 as well, or the compiler would
+//pass the registers around with the wrong calling convention
+template <typename T>
+EA_SIMD_AVX2_TARGET void mixAVX2(T* dest, const T* source, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto sum =
+            Batch::add(Batch::load(dest + index), Batch::load(source + index));
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::mix(dest + index, source + index, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET void
+    mixWithGainAVX2(T* dest, const T* source, T gain, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto gains = Batch::broadcast(gain);
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto sum = Batch::multiplyAdd(
+            Batch::load(dest + index), Batch::load(source + index), gains);
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::mixWithGain(dest + index, source + index, gain, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET void scaleAVX2(T* dest, T gain, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto gains = Batch::broadcast(gain);
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto scaled = Batch::multiply(Batch::load(dest + index), gains);
+        Batch::store(dest + index, scaled);
+    }
+
+    Scalar::scale(dest + index, gain, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET void
+    multiplyAddAVX2(T* dest, const T* first, const T* second, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto sum = Batch::multiplyAdd(Batch::load(dest + index),
+                                      Batch::load(first + index),
+                                      Batch::load(second + index));
+        Batch::store(dest + index, sum);
+    }
+
+    Scalar::multiplyAdd(dest + index, first + index, second + index, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET void multiplyAVX2(T* dest, const T* source, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto product =
+            Batch::multiply(Batch::load(dest + index), Batch::load(source + index));
+        Batch::store(dest + index, product);
+    }
+
+    Scalar::multiply(dest + index, source + index, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET void
+    applyGainRampAVX2(T* dest, T startGain, T step, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto starts = Batch::broadcast(startGain);
+    auto steps = Batch::broadcast(step);
+    auto lanes = Batch::laneIndexes();
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto positions = Batch::add(Batch::broadcast((T) index), lanes);
+        auto gains = Batch::multiplyAdd(starts, positions, steps);
+        auto ramped = Batch::multiply(Batch::load(dest + index), gains);
+        Batch::store(dest + index, ramped);
+    }
+
+    auto gain = startGain + step * (T) index;
+    Scalar::applyGainRamp(dest + index, gain, step, size - index);
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET T sumOfSquaresAVX2(const T* source, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto sums = Batch::broadcast(T(0));
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+    {
+        auto values = Batch::load(source + index);
+        sums = Batch::multiplyAdd(sums, values, values);
+    }
+
+    T lanes[Batch::width] {};
+    Batch::store(lanes, sums);
+
+    auto sum = Scalar::sumOfSquares(source + index, size - index);
+
+    for (auto lane: lanes)
+        sum += lane;
+
+    return sum;
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET MinMax<T> findMinMaxAVX2(const T* source, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    constexpr int width = Batch::width;
+
+    if (size < width)
+        return Scalar::findMinMax(source, size);
+
+    auto minimums = Batch::load(source);
+    auto maximums = minimums;
+    auto index = width;
+
+    for (; index + width <= size; index += width)
+    {
+        auto values = Batch::load(source + index);
+        minimums = Batch::min(minimums, values);
+        maximums = Batch::max(maximums, values);
+    }
+
+    T lowest[width] {};
+    T highest[width] {};
+    Batch::store(lowest, minimums);
+    Batch::store(highest, maximums);
+
+    auto result = MinMax<T> {lowest[0], highest[0]};
+
+    for (int lane = 1; lane < width; ++lane)
+    {
+        result.min = std::min(result.min, lowest[lane]);
+        result.max = std::max(result.max, highest[lane]);
+    }
+
+    for (; index < size; ++index)
+    {
+        result.min = std::min(result.min, source[index]);
+        result.max = std::max(result.max, source[index]);
+    }
+
+    return result;
+}
+
+template <typename T>
+EA_SIMD_AVX2_TARGET T findPeakAVX2(const T* source, int size) noexcept
+{
+    using Batch = Batch256<T>;
+    auto peaks = Batch::broadcast(T(0));
+    auto index = 0;
+
+    for (; index + Batch::width <= size; index += Batch::width)
+        peaks = Batch::max(peaks, Batch::abs(Batch::load(source + index)));
+
+    T lanes[Batch::width] {};
+    Batch::store(lanes, peaks);
+
+    auto peak = Scalar::findPeak(source + index, size - index);
+
+    for (auto lane: lanes)
+        peak = std::max(peak, lane);
+
+    return peak;
+}
+
+    #if defined(_MSC_VER)
+        #if defined(__clang__)
+__attribute__((target("xsave")))
+        #endif
+inline bool detectAVX2()
+{
+    int info[4] {};
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+
+    auto hasFMA = (info[2] & (1 << 12)) != 0;
+    auto hasOSXSave = (info[2] & (1 << 27)) != 0;
+    auto hasAVX = (info[2] & (1 << 28)) != 0;
+
+    if (!hasFMA || !hasOSXSave || !hasAVX)
+        return false;
+
+    //The OS has to save the YMM registers on context switches
+    if ((_xgetbv(0) & 6) != 6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+}
+    #else
+inline bool detectAVX2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+    #endif
+#elif defined(EA_SIMD_NEON)
+template <>
+struct Batch128<float>
+{
+    using Register = float32x4_t;
+    static constexpr int width = 4;
+
+    static Register load(const float* source) { return vld1q_f32(source); }
+    static void store(float* dest, Register value) { vst1q_f32(dest, value); }
+    static Register broadcast(float value) { return vdupq_n_f32(value); }
+    static Register add(Register a, Register b) { return vaddq_f32(a, b); }
+    static Register multiply(Register a, Register b) { return vmulq_f32(a, b); }
+
+    //a + b * c
+    static Register multiplyAdd(Register a, Register b, Register c)
+    {
+        return vfmaq_f32(a, b, c);
+    }
+
+    static Register min(Register a, Register b) { return vminq_f32(a, b); }
+    static Register max(Register a, Register b) { return vmaxq_f32(a, b); }
+    static Register abs(Register a) { return vabsq_f32(a); }
+
+    static Register laneIndexes()
+    {
+        const float lanes[] = {0.f, 1.f, 2.f, 3.f};
+        return vld1q_f32(lanes);
+    }
+
+    //{a0, b0, a1, b1} and {a2, b2, a3, b3}
+    static Register interleaveLow(Register a, Register b)
+    {
+        return vzip1q_f32(a, b);
+    }
+
+    static Register interleaveHigh(Register a, Register b)
+    {
+        return vzip2q_f32(a, b);
+    }
+
+    //{a0, a2, b0, b2} and {a1, a3, b1, b3}
+    static Register evenLanes(Register a, Register b) { return vuzp1q_f32(a, b); }
+    static Register oddLanes(Register a, Register b) { return vuzp2q_f32(a, b); }
+};
+
+template <>
+struct Batch128<double>
+{
+    using Register = float64x2_t;
+    static constexpr int width = 2;
+
+    static Register load(const double* source) { return vld1q_f64(source); }
+    static void store(double* dest, Register value) { vst1q_f64(dest, value); }
+    static Register broadcast(double value) { return vdupq_n_f64(value); }
+    static Register add(Register a, Register b) { return vaddq_f64(a, b); }
+    static Register multiply(Register a, Register b) { return vmulq_f64(a, b); }
+
+    static Register multiplyAdd(Register a, Register b, Register c)
+    {
+        return vfmaq_f64(a, b, c);
+    }
+
+    static Register min(Register a, Register b) { return vminq_f64(a, b); }
+    static Register max(Register a, Register b) { return vmaxq_f64(a, b); }
+    static Register abs(Register a) { return vabsq_f64(a); }
+
+    static Register laneIndexes()
+    {
+        const double lanes[] = {0.0, 1.0};
+        return vld1q_f64(lanes);
+    }
+
+    static Register interleaveLow(Register a, Register b)
+    {
+        return vzip1q_f64(a, b);
+    }
+
+    static Register interleaveHigh(Register a, Register b)
+    {
+        return vzip2q_f64(a, b);
+    }
+    static Register evenLanes(Register a, Register b) { return vuzp1q_f64(a, b); }
+    static Register oddLanes(Register a, Register b) { return vuzp2q_f64(a, b); }
+};
+#endif
+} // namespace Detail
+
+//Whether the AVX2/FMA kernels are in use on this machine
+inline bool hasAVX2() noexcept
+{
+#if defined(EA_SIMD_AVX2)
+    static const bool supported = Detail::detectAVX2();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+//dest[i] += source[i]
+template <typename T>
+void mix(T* dest, const T* source, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::mixAVX2(dest, source, size);
+    #endif
+
+        return Detail::mix<Detail::Batch128<T>>(dest, source, size);
+    }
+#endif
+
+    Scalar::mix(dest, source, size);
+}
+
+//dest[i] += source[i] * gain
+template <typename T>
+void mixWithGain(T* dest, const T* source, T gain, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::mixWithGainAVX2(dest, source, gain, size);
+    #endif
+
+        return Detail::mixWithGain<Detail::Batch128<T>>(dest, source, gain, size);
+    }
+#endif
+
+    Scalar::mixWithGain(dest, source, gain, size);
+}
+
+//dest[i] = value
+//Stores alone gain nothing from explicit SIMD: std::fill_n already becomes
+//memset or the widest store loop the compiler knows, so all types use it
+template <typename T>
+void fill(T* dest, T value, int size) noexcept
+{
+    std::fill_n(dest, size, value);
+}
+
+//dest[i] *= gain
+template <typename T>
+void scale(T* dest, T gain, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::scaleAVX2(dest, gain, size);
+    #endif
+
+        return Detail::scale<Detail::Batch128<T>>(dest, gain, size);
+    }
+#endif
+
+    Scalar::scale(dest, gain, size);
+}
+
+//dest[i] += first[i] * second[i]
+template <typename T>
+void multiplyAdd(T* dest, const T* first, const T* second, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::multiplyAddAVX2(dest, first, second, size);
+    #endif
+
+        return Detail::multiplyAdd<Detail::Batch128<T>>(dest, first, second, size);
+    }
+#endif
+
+    Scalar::multiplyAdd(dest, first, second, size);
+}
+
+//dest[i] *= source[i]
+template <typename T>
+void multiply(T* dest, const T* source, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::multiplyAVX2(dest, source, size);
+    #endif
+
+        return Detail::multiply<Detail::Batch128<T>>(dest, source, size);
+    }
+#endif
+
+    Scalar::multiply(dest, source, size);
+}
+
+//dest[i] *= a gain moving linearly from startGain towards endGain.
+//endGain is the gain the sample after the last one would get, so a ramp
+//split over consecutive blocks continues without a step.
+template <typename T>
+void applyGainRamp(T* dest, T startGain, T endGain, int size) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "Gain ramps need floating point");
+
+    if (size <= 0)
+        return;
+
+    auto step = (endGain - startGain) / (T) size;
+
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::applyGainRampAVX2(dest, startGain, step, size);
+    #endif
+
+        using Batch = Detail::Batch128<T>;
+        return Detail::applyGainRamp<Batch>(dest, startGain, step, size);
+    }
+#endif
+
+    Scalar::applyGainRamp(dest, startGain, step, size);
+}
+
+//The sum of source[i] * source[i]
+template <typename T>
+T sumOfSquares(const T* source, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::sumOfSquaresAVX2(source, size);
+    #endif
+
+        return Detail::sumOfSquares<Detail::Batch128<T>>(source, size);
+    }
+#endif
+
+    return Scalar::sumOfSquares(source, size);
+}
+
+//The root mean square level, 0 for an empty buffer
+template <typename T>
+T getRMS(const T* source, int size) noexcept
+{
+    static_assert(std::is_floating_point_v<T>, "RMS needs floating point");
+
+    if (size <= 0)
+        return T(0);
+
+    return std::sqrt(sumOfSquares(source, size) / (T) size);
+}
+
+//{0, 0} for an empty buffer
+template <typename T>
+MinMax<T> findMinMax(const T* source, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::findMinMaxAVX2(source, size);
+    #endif
+
+        return Detail::findMinMax<Detail::Batch128<T>>(source, size);
+    }
+#endif
+
+    return Scalar::findMinMax(source, size);
+}
+
+//The largest absolute value, 0 for an empty buffer
+template <typename T>
+T findPeak(const T* source, int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+    #if defined(EA_SIMD_AVX2)
+        if (hasAVX2())
+            return Detail::findPeakAVX2(source, size);
+    #endif
+
+        return Detail::findPeak<Detail::Batch128<T>>(source, size);
+    }
+#endif
+
+    return Scalar::findPeak(source, size);
+}
+
+//dest[i * numChannels + channel] = sources[channel][i]
+//Stereo float/double buffers use the SIMD shuffles, the rest plain loops.
+template <typename T>
+void interleave(T* dest,
+                const T* const* sources,
+                int numChannels,
+                int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+        if (numChannels == 2)
+        {
+            using Batch = Detail::Batch128<T>;
+            return Detail::interleave2<Batch>(dest, sources[0], sources[1], size);
+        }
+    }
+#endif
+
+    Scalar::interleave(dest, sources, numChannels, size);
+}
+
+//dests[channel][i] = source[i * numChannels + channel]
+template <typename T>
+void deinterleave(T* const* dests,
+                  const T* source,
+                  int numChannels,
+                  int size) noexcept
+{
+#if defined(EA_SIMD_SSE2) || defined(EA_SIMD_NEON)
+    if constexpr (isAccelerated<T>())
+    {
+        if (numChannels == 2)
+        {
+            using Batch = Detail::Batch128<T>;
+            return Detail::deinterleave2<Batch>(dests[0], dests[1], source, size);
+        }
+    }
+#endif
+
+    Scalar::deinterleave(dests, source, numChannels, size);
+}
+} // namespace EA::SIMD
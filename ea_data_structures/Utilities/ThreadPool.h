@@ -0,0 +1,277 @@
+#pragma once
+
+#include "../Flags/CacheLine.h"
+#include "../Flags/CopyableAtomic.h"
+#include "../Flags/Locks.h"
+#include "../Flags/SpinHint.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace EA
+{
+/*
+ * A fixed set of worker threads for fork-join work, like the parallel
+ * algorithms in Vectors.
+ *
+ * run(numTasks, func) calls func(index) for every index in [0, numTasks),
+ * spread over the workers and the calling thread, and returns once all of
+ * them are done.
+ *
+ * Every worker has its own queue. It takes tasks from the back of it, and
+ * once it's empty steals from the front of the others', so a worker that got
+ * the quick tasks helps with the slow ones (work stealing). The calling
+ * thread steals as well while it waits, so run() can be nested in a task.
+ *
+ * Tasks must not throw.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int numWorkersToUse = getDefaultNumWorkers())
+        : numWorkers(std::max(numWorkersToUse, 0))
+        , queues(std::make_unique<CacheLinePadded<Queue>[]>(
+              (size_t) std::max(numWorkers, 1)))
+    {
+        for (int index = 0; index < numWorkers; ++index)
+            workers.emplace_back([this, index] { work(index); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //Finishes the queued tasks, then joins the workers
+    ~ThreadPool()
+    {
+        {
+            auto lock = std::lock_guard(sleepMutex);
+            stopping = true;
+        }
+
+        sleepCondition.notify_all();
+
+        for (auto& worker: workers)
+            worker.join();
+    }
+
+    //One thread per core, counting the thread that calls run()
+    static int getDefaultNumWorkers()
+    {
+        return std::max((int) std::thread::hardware_concurrency() - 1, 0);
+    }
+
+    //Shared by everything that doesn't pass its own pool
+    static ThreadPool& getDefault()
+    {
+        static auto pool = ThreadPool();
+        return pool;
+    }
+
+    int getNumWorkers() const noexcept { return numWorkers; }
+
+    template <typename Func>
+    void run(int numTasks, Func&& func)
+    {
+        if (numTasks <= 0)
+            return;
+
+        if (numWorkers == 0 || numTasks == 1)
+        {
+            for (int index = 0; index < numTasks; ++index)
+                func(index);
+
+            return;
+        }
+
+        auto batch = Batch();
+        batch.context = (void*) std::addressof(func);
+        batch.remaining.store(numTasks);
+        batch.function = [](void* context, int index)
+        { (*static_cast<std::remove_reference_t<Func>*>(context))(index); };
+
+        push(batch, numTasks);
+        execute({&batch, 0});
+        waitFor(batch);
+    }
+
+private:
+    struct Batch
+    {
+        void (*function)(void*, int) = nullptr;
+        void* context = nullptr;
+        Atomic<int> remaining {0};
+
+        //Set by the thread that finished the last task, once it's done with
+        //the batch
+        Atomic<bool> released {false};
+    };
+
+    struct Task
+    {
+        Batch* batch = nullptr;
+        int index = 0;
+    };
+
+    struct Queue
+    {
+        Locks::PrimitiveSpinLock lock;
+        std::deque<Task> tasks;
+    };
+
+    //Which worker of which pool this thread is, if any
+    struct WorkerSlot
+    {
+        ThreadPool* pool = nullptr;
+        int index = -1;
+    };
+
+    static WorkerSlot& getThisThread()
+    {
+        thread_local auto slot = WorkerSlot();
+        return slot;
+    }
+
+    int getWorkerIndex() const
+    {
+        auto& slot = getThisThread();
+        return slot.pool == this ? slot.index : -1;
+    }
+
+    //Task 0 is left for the caller. A worker keeps the rest in its own queue
+    //for the others to steal, other threads deal them out to all queues.
+    void push(Batch& batch, int numTasks)
+    {
+        auto self = getWorkerIndex();
+
+        for (int index = 1; index < numTasks; ++index)
+        {
+            auto& queue = queues[self >= 0 ? self : index % numWorkers].value;
+            auto guard = Locks::ScopedSpinLock(queue.lock);
+            queue.tasks.push_back({&batch, index});
+        }
+
+        numQueued.fetch_add(numTasks - 1);
+
+        {
+            auto lock = std::lock_guard(sleepMutex);
+        }
+
+        sleepCondition.notify_all();
+    }
+
+    //From the back of the own queue first, then from the front of the others
+    bool tryTake(int self, Task& task)
+    {
+        if (self >= 0 && tryPop(queues[self].value, task, true))
+            return true;
+
+        for (int offset = 1; offset <= numWorkers; ++offset)
+        {
+            auto victim = (std::max(self, 0) + offset) % numWorkers;
+
+            if (victim != self && tryPop(queues[victim].value, task, false))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool tryPop(Queue& queue, Task& task, bool fromBack)
+    {
+        auto guard = Locks::ScopedSpinLock(queue.lock);
+
+        if (queue.tasks.empty())
+            return false;
+
+        if (fromBack)
+        {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+
+        numQueued.fetch_sub(1);
+        return true;
+    }
+
+    //The batch may be gone as soon as released is set, so it's the last
+    //thing touched
+    static void execute(Task task)
+    {
+        auto* batch = task.batch;
+        batch->function(batch->context, task.index);
+
+        if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            batch->remaining.notify_all();
+            batch->released.store(true, std::memory_order_release);
+        }
+    }
+
+    //Helps with queued tasks while the batch runs, and sleeps once there's
+    //nothing left to take, until the last task wakes it
+    void waitFor(Batch& batch)
+    {
+        auto self = getWorkerIndex();
+        auto task = Task();
+
+        while (true)
+        {
+            auto remaining = batch.remaining.load(std::memory_order_acquire);
+
+            if (remaining == 0)
+                break;
+
+            if (tryTake(self, task))
+                execute(task);
+            else
+                batch.remaining.wait(remaining, std::memory_order_acquire);
+        }
+
+        //The last task's thread may still be inside notify_all()
+        while (!batch.released.load(std::memory_order_acquire))
+            spinHint();
+    }
+
+    void work(int index)
+    {
+        getThisThread() = {this, index};
+        auto task = Task();
+
+        while (true)
+        {
+            if (tryTake(index, task))
+            {
+                execute(task);
+                continue;
+            }
+
+            auto lock = std::unique_lock(sleepMutex);
+            sleepCondition.wait(lock,
+                                [this] { return stopping || numQueued.load() > 0; });
+
+            if (stopping && numQueued.load() == 0)
+                return;
+        }
+    }
+
+    int numWorkers;
+    std::unique_ptr<CacheLinePadded<Queue>[]> queues;
+    Atomic<int> numQueued {0};
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    bool stopping = false;
+
+    std::vector<std::thread> workers;
+};
+} // namespace EA
@@ -17,10 +17,14 @@ Vectors::addIfNotThere(myVector, element).
 
 #pragma once
 
+#include "Execution.h"
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iterator>
+#include <optional>
 #include <ranges>
+#include <vector>
 
 namespace EA::Ranges
 {
@@ -155,40 +159,50 @@ void reverse(T& container)
     std::ranges::reverse(container);
 }
 
+namespace Detail
+{
+//Compares the other way around, so sorting backwards needs no extra pass
+template <typename Compare>
+auto getReversed(Compare compare)
+{
+    return [compare](const auto& first, const auto& second)
+    { return compare(second, first); };
+}
+} // namespace Detail
+
 template <typename T, typename Func>
+    requires(!Execution::Policy<T>)
 void stableSort(T& container, Func&& func, bool forward = true)
 {
-    std::stable_sort(container.begin(), container.end(), std::forward<Func>(func));
+    auto first = container.begin();
+    auto last = container.end();
 
-    if (!forward)
-        reverse(container);
+    if (forward)
+        std::stable_sort(first, last, std::forward<Func>(func));
+    else
+        std::stable_sort(first, last, Detail::getReversed(func));
 }
 
 template <typename T>
 void stableSort(T& container, bool forward = true)
 {
-    std::stable_sort(container.begin(), container.end());
-
-    if (!forward)
-        reverse(container);
-}
-
-template <typename T>
-void sort(T& container, bool forward = true)
-{
-    std::sort(container.begin(), container.end());
-
-    if (!forward)
-        reverse(container);
+    stableSort(container, std::less<>(), forward);
 }
 
 template <typename T, typename COMPARE>
+    requires(!Execution::Policy<T>)
 void sort(T& container, COMPARE compare, bool forward = true)
 {
-    std::sort(container.begin(), container.end(), compare);
+    if (forward)
+        std::sort(container.begin(), container.end(), compare);
+    else
+        std::sort(container.begin(), container.end(), Detail::getReversed(compare));
+}
 
-    if (!forward)
-        reverse(container);
+template <typename T>
+void sort(T& container, bool forward = true)
+{
+    sort(container, std::less<>(), forward);
 }
 
 // Check if an element that be compared to elements of this container exist.
@@ -256,24 +270,104 @@ void removeFirstMatch(T& container, A& elementToCheck)
         removeAt(container, index);
 }
 
-// Removes all matches of an element in the container
+// Removes all matches of an element in the container, in one pass
 template <typename T, typename A>
 int removeAllMatches(T& container, A& elementToCheck)
 {
-    int removedElements = 0;
+    auto numElements = (int) container.size();
+    auto removed = std::remove(container.begin(), container.end(), elementToCheck);
+    container.erase(removed, container.end());
+
+    return numElements - (int) container.size();
+}
+
+// Removes the elements at the given indexes in one pass, keeping the order of
+// the rest, so it's O(n) however many are removed. Indexes out of range and
+// repeated ones are skipped. indexes gets sorted if it isn't already.
+template <typename T, typename Indexes>
+int removeIndexes(T& container, Indexes& indexes)
+{
+    auto first = std::begin(indexes);
+    auto last = std::end(indexes);
+
+    if (!std::is_sorted(first, last))
+        std::sort(first, last);
 
     auto numElements = (int) container.size();
+    auto next = std::lower_bound(first, last, 0);
 
-    for (int index = numElements - 1; index >= 0; --index)
+    if (next == last || *next >= numElements)
+        return 0;
+
+    auto elements = container.begin();
+    auto write = *next;
+
+    for (auto read = write; read < numElements; ++read)
+    {
+        if (next != last && *next == read)
+        {
+            while (next != last && *next == read)
+                ++next;
+
+            continue;
+        }
+
+        elements[write++] = std::move(elements[read]);
+    }
+
+    container.erase(elements + write, container.end());
+    return numElements - write;
+}
+
+// Like std::remove_if, but fills each gap with an element from the end instead
+// of shifting everything after it down. Moves far fewer elements, but doesn't
+// keep the order. Returns the new end.
+template <typename Iterator, typename Callable>
+Iterator unorderedRemoveIf(Iterator first, Iterator last, Callable&& callable)
+{
+    while (first != last)
     {
-        if (*(container.begin() + index) == elementToCheck)
+        if (callable(*first))
         {
-            ++removedElements;
-            removeAt(container, index);
+            --last;
+
+            if (first != last)
+                *first = std::move(*last);
         }
+        else
+            ++first;
     }
 
-    return removedElements;
+    return last;
+}
+
+// eraseIf() that doesn't keep the order, see unorderedRemoveIf()
+template <typename Container, typename Callable>
+bool unorderedEraseIf(Container& container, Callable callable)
+{
+    auto removed = unorderedRemoveIf(container.begin(), container.end(), callable);
+    auto erased = removed != container.end();
+
+    container.erase(removed, container.end());
+    return erased;
+}
+
+// Removes the element at index in O(1), by moving the last element into its
+// place. Doesn't keep the order.
+template <typename T>
+void swapRemove(T& container, int index)
+{
+    auto numElements = (int) container.size();
+
+    if (index < 0 || index >= numElements)
+        return;
+
+    auto elements = container.begin();
+
+    if (index != numElements - 1)
+        elements[index] = std::move(elements[numElements - 1]);
+
+    container.pop_back();
 }
 
 // Adds the element at the end only if doesn't already exist in the container
@@ -373,26 +467,76 @@ CallableType zipWithIndexed(const FirstContainerType& firstContainer,
     return call;
 }
 
+namespace Detail
+{
+//The same kind of container, holding NewType elements instead
+template <typename Container, typename NewType>
+struct Rebind;
+
+template <template <typename, int> typename Container,
+          typename T,
+          int Size,
+          typename NewType>
+struct Rebind<Container<T, Size>, NewType>
+{
+    using Type = Container<NewType, Size>;
+};
+
+template <template <typename, typename> typename Container,
+          typename T,
+          typename Allocator,
+          typename NewType>
+struct Rebind<Container<T, Allocator>, NewType>
+{
+    using NewAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<NewType>;
+    using Type = Container<NewType, NewAllocator>;
+};
+
+template <template <typename, typename, typename> typename Container,
+          typename T,
+          typename Allocator,
+          typename Extra,
+          typename NewType>
+struct Rebind<Container<T, Allocator, Extra>, NewType>
+{
+    using NewAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<NewType>;
+    using Type = Container<NewType, NewAllocator, Extra>;
+};
+
+template <template <typename, typename, typename, typename> typename Container,
+          typename T,
+          typename Allocator,
+          typename Extra,
+          typename MoreExtra,
+          typename NewType>
+struct Rebind<Container<T, Allocator, Extra, MoreExtra>, NewType>
+{
+    using NewAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<NewType>;
+    using Type = Container<NewType, NewAllocator, Extra, MoreExtra>;
+};
+
+template <typename Container, typename Func>
+using TransformResult = typename Rebind<
+    Container,
+    std::decay_t<decltype(std::declval<Func&>()(
+        *std::begin(std::declval<const Container&>())))>>::Type;
+} // namespace Detail
+
 /**
  *  Applies the given function over each element of the source container and
- * returns the results in a new container.
+ * returns the results in a new container of the same kind.
  */
-template <template <typename, int> typename VectorType,
-          typename ElemType,
-          int Sz,
-          typename Func>
-auto transform(const VectorType<ElemType, Sz>& container, Func&& f)
+template <typename Container, typename Func>
+auto transform(const Container& container, Func&& f)
 {
-    using New_Elem_T = decltype(f(*container.begin()));
+    auto results = Detail::TransformResult<Container, Func>();
+    results.resize(container.size());
 
-    VectorType<New_Elem_T, Sz> new_container;
-    new_container.resize(container.size());
-
-    std::ranges::transform(container,
-                           std::ranges::begin(new_container),
-                           std::forward<Func>(f));
-
-    return std::move(new_container);
+    std::ranges::transform(container, std::ranges::begin(results), f);
+    return results;
 }
 
 /**
@@ -417,7 +561,7 @@ auto fold(ContainerType&& container, Func func)
 {
     assert(container.size() > 0);
     auto value = *container.begin();
-    for (int i = 1; i < container.size(); ++i)
+    for (int i = 1; i < (int) container.size(); ++i)
     {
         value = func(value, container[i]);
     }
@@ -439,6 +583,352 @@ auto foldr(ContainerType&& container, Func func)
     return value;
 }
 
+// Parallel overloads: the same algorithms, taking an execution policy first,
+// e.g. Vectors::sort(Execution::par, vec). Execution::seq, and containers
+// smaller than the policy's minParallelSize, run the serial versions.
+namespace Detail
+{
+//Into how many slices to cut size elements. 1 means run serially.
+template <typename Policy>
+int getNumSlices(const Policy& policy, int size)
+{
+    if constexpr (Execution::isParallel<Policy>())
+    {
+        auto numThreads = policy.getPool().getNumWorkers() + 1;
+
+        if (numThreads > 1 && size >= std::max(policy.minParallelSize, 2))
+            return std::min(size, numThreads * 4);
+    }
+
+    return 1;
+}
+
+inline int getSliceStart(int size, int numSlices, int slice)
+{
+    return (int) ((long long) size * slice / numSlices);
+}
+
+//Calls func(slice, start, end) for each slice, on the policy's pool when
+//there's more than one
+template <typename Policy, typename Func>
+void forEachSlice(const Policy& policy, int size, int numSlices, Func&& func)
+{
+    auto runSlice = [&](int slice)
+    {
+        func(slice,
+             getSliceStart(size, numSlices, slice),
+             getSliceStart(size, numSlices, slice + 1));
+    };
+
+    if constexpr (Execution::isParallel<Policy>())
+    {
+        if (numSlices > 1)
+        {
+            policy.getPool().run(numSlices, runSlice);
+            return;
+        }
+    }
+
+    for (int slice = 0; slice < numSlices; ++slice)
+        runSlice(slice);
+}
+
+//Sorts the slices with sortRange, then merges neighbours in
+//rounds, each round in parallel. std::inplace_merge is stable, so the result
+//is stable if sortRange is. Below the threshold it's just sortRange.
+template <typename Policy, typename T, typename Compare, typename SortFunc>
+void sortInSlices(const Policy& policy,
+                  T& container,
+                  Compare compare,
+                  SortFunc sortRange)
+{
+    auto first = container.begin();
+    auto size = (int) container.size();
+    auto numSlices = getNumSlices(policy, size);
+
+    if (numSlices == 1)
+    {
+        sortRange(first, container.end(), compare);
+        return;
+    }
+
+    if constexpr (Execution::isParallel<Policy>())
+    {
+        auto& pool = policy.getPool();
+
+        pool.run(numSlices,
+                 [&](int slice)
+                 {
+                     sortRange(first + getSliceStart(size, numSlices, slice),
+                               first + getSliceStart(size, numSlices, slice + 1),
+                               compare);
+                 });
+
+        for (int width = 1; width < numSlices; width *= 2)
+        {
+            auto numMerges = (numSlices + width * 2 - 1) / (width * 2);
+
+            pool.run(numMerges,
+                     [&](int merge)
+                     {
+                         auto start = merge * width * 2;
+                         auto middle = std::min(start + width, numSlices);
+                         auto end = std::min(start + width * 2, numSlices);
+
+                         if (middle < end)
+                         {
+                             std::inplace_merge(
+                                 first + getSliceStart(size, numSlices, start),
+                                 first + getSliceStart(size, numSlices, middle),
+                                 first + getSliceStart(size, numSlices, end),
+                                 compare);
+                         }
+                     });
+        }
+    }
+}
+} // namespace Detail
+
+template <Execution::Policy Policy, typename T, typename Compare>
+void sort(const Policy& policy, T& container, Compare compare, bool forward = true)
+{
+    auto sortRange = [](auto first, auto last, auto& comparison)
+    { std::sort(first, last, comparison); };
+
+    if (forward)
+        Detail::sortInSlices(policy, container, compare, sortRange);
+    else
+    {
+        auto reversed = Detail::getReversed(compare);
+        Detail::sortInSlices(policy, container, reversed, sortRange);
+    }
+}
+
+template <Execution::Policy Policy, typename T>
+void sort(const Policy& policy, T& container, bool forward = true)
+{
+    sort(policy, container, std::less<>(), forward);
+}
+
+template <Execution::Policy Policy, typename T, typename Compare>
+void stableSort(const Policy& policy,
+                T& container,
+                Compare compare,
+                bool forward = true)
+{
+    auto sortRange = [](auto first, auto last, auto& comparison)
+    { std::stable_sort(first, last, comparison); };
+
+    if (forward)
+        Detail::sortInSlices(policy, container, compare, sortRange);
+    else
+    {
+        auto reversed = Detail::getReversed(compare);
+        Detail::sortInSlices(policy, container, reversed, sortRange);
+    }
+}
+
+template <Execution::Policy Policy, typename T>
+void stableSort(const Policy& policy, T& container, bool forward = true)
+{
+    stableSort(policy, container, std::less<>(), forward);
+}
+
+template <Execution::Policy Policy, typename Container, typename Func>
+auto transform(const Policy& policy, const Container& container, Func&& f)
+{
+    auto size = (int) container.size();
+    auto results = Detail::TransformResult<Container, Func>();
+    results.resize(container.size());
+
+    auto source = container.begin();
+    auto dest = results.begin();
+    auto numSlices = 1;
+
+    //Neighbouring slices of a bit-packed result (std::vector<bool>) share
+    //words, so only results with real element storage are filled in parallel
+    if constexpr (std::contiguous_iterator<decltype(dest)>)
+        numSlices = Detail::getNumSlices(policy, size);
+
+    Detail::forEachSlice(policy,
+                         size,
+                         numSlices,
+                         [&](int, int start, int end)
+                         {
+                             std::transform(
+                                 source + start, source + end, dest + start, f);
+                         });
+
+    return results;
+}
+
+// Keeps the order of the elements. Each slice collects its matches apart,
+// and they're joined at the end.
+template <Execution::Policy Policy, typename Container, typename Func>
+auto filter(const Policy& policy, const Container& container, Func&& predicate)
+{
+    auto size = (int) container.size();
+    auto numSlices = Detail::getNumSlices(policy, size);
+
+    if (numSlices == 1)
+        return filter(container, predicate);
+
+    auto parts = std::vector<Container>((size_t) numSlices);
+    auto source = container.begin();
+
+    Detail::forEachSlice(policy,
+                         size,
+                         numSlices,
+                         [&](int slice, int start, int end)
+                         {
+                             std::copy_if(source + start,
+                                          source + end,
+                                          std::back_inserter(parts[(size_t) slice]),
+                                          predicate);
+                         });
+
+    auto results = Container();
+    auto numResults = 0;
+
+    for (auto& part: parts)
+        numResults += (int) part.size();
+
+    if constexpr (requires { results.reserve(numResults); })
+        results.reserve(numResults);
+
+    for (auto& part: parts)
+        std::move(part.begin(), part.end(), std::back_inserter(results));
+
+    return results;
+}
+
+// Folds each slice, then folds the results left to right, so func has to be
+// associative (a + b, std::max...) for this to match the serial fold()
+template <Execution::Policy Policy, typename ContainerType, typename Func>
+auto fold(const Policy& policy, ContainerType&& container, Func func)
+{
+    assert(container.size() > 0);
+
+    auto size = (int) container.size();
+    auto numSlices = Detail::getNumSlices(policy, size);
+
+    if (numSlices == 1)
+        return fold(container, func);
+
+    using Value = std::decay_t<decltype(*container.begin())>;
+
+    auto partials = std::vector<std::optional<Value>>((size_t) numSlices);
+    auto source = container.begin();
+
+    Detail::forEachSlice(policy,
+                         size,
+                         numSlices,
+                         [&](int slice, int start, int end)
+                         {
+                             auto value = Value(source[start]);
+
+                             for (int index = start + 1; index < end; ++index)
+                                 value = func(value, source[index]);
+
+                             partials[(size_t) slice] = std::move(value);
+                         });
+
+    auto value = std::move(*partials[0]);
+
+    for (int slice = 1; slice < numSlices; ++slice)
+        value = func(value, *partials[(size_t) slice]);
+
+    return value;
+}
+
+// Keeps the order of the rest. Each slice is compacted in place in parallel,
+// then the kept parts are moved together.
+template <Execution::Policy Policy, typename Container, typename Callable>
+bool eraseIf(const Policy& policy, Container& container, Callable callable)
+{
+    auto size = (int) container.size();
+    auto numSlices = Detail::getNumSlices(policy, size);
+
+    if (numSlices == 1)
+        return eraseIf(container, callable);
+
+    auto numKept = std::vector<int>((size_t) numSlices);
+    auto first = container.begin();
+
+    Detail::forEachSlice(policy,
+                         size,
+                         numSlices,
+                         [&](int slice, int start, int end)
+                         {
+                             auto sliceStart = first + start;
+                             auto kept =
+                                 std::remove_if(sliceStart, first + end, callable);
+                             numKept[(size_t) slice] = (int) (kept - sliceStart);
+                         });
+
+    auto write = first + numKept[0];
+
+    for (int slice = 1; slice < numSlices; ++slice)
+    {
+        auto start = first + Detail::getSliceStart(size, numSlices, slice);
+        write = std::move(start, start + numKept[(size_t) slice], write);
+    }
+
+    auto erased = write != container.end();
+    container.erase(write, container.end());
+
+    return erased;
+}
+
+// The index of the first match, or -1. Slices stop early once a match was
+// found before them.
+template <Execution::Policy Policy, typename T, typename A>
+int getIndexOf(const Policy& policy, const T& container, const A& element)
+{
+    auto size = (int) container.size();
+    auto numSlices = Detail::getNumSlices(policy, size);
+
+    if (numSlices == 1)
+        return getIndexOf(container, element);
+
+    constexpr auto blockSize = 4096;
+
+    auto found = Atomic<int>(size);
+    auto source = container.begin();
+
+    Detail::forEachSlice(
+        policy,
+        size,
+        numSlices,
+        [&](int, int start, int end)
+        {
+            for (auto block = start; block < end; block += blockSize)
+            {
+                if (block >= found.load(std::memory_order_relaxed))
+                    return;
+
+                auto blockEnd = std::min(block + blockSize, end);
+                auto match = std::find(source + block, source + blockEnd, element);
+
+                if (match != source + blockEnd)
+                {
+                    auto index = (int) (match - source);
+                    auto current = found.load();
+
+                    while (index < current
+                           && !found.compare_exchange_weak(current, index))
+                    {
+                    }
+
+                    return;
+                }
+            }
+        });
+
+    auto index = found.load();
+    return index == size ? -1 : index;
+}
+
 template <typename Container, typename IndexType>
 constexpr auto sizeType(IndexType index)
 {
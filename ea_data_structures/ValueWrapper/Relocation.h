@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace EA
+{
+//Opt-in for types that can move to another address by copying their bytes,
+//after which the old bytes are dropped without running the destructor.
+//Holds for most handles that don't point into themselves, like OwningPointer
+//or a shared_ptr. Specialize it to std::true_type next to the type.
+//Trivially copyable types don't need to.
+template <typename T>
+struct TriviallyRelocatable : std::false_type
+{
+};
+
+template <typename T>
+constexpr bool isTriviallyRelocatable()
+{
+    using Type = std::remove_cv_t<T>;
+    return std::is_trivially_copyable_v<Type> || TriviallyRelocatable<Type>::value;
+}
+
+namespace Relocation
+{
+//Moves count objects from source into raw memory at dest, leaving source as
+//raw memory. The ranges may not overlap.
+template <typename T>
+void relocate(T* source, int count, T* dest) noexcept
+{
+    if (count <= 0)
+        return;
+
+    if constexpr (isTriviallyRelocatable<T>())
+        std::memcpy((void*) dest, (const void*) source, sizeof(T) * (size_t) count);
+    else
+    {
+        for (int index = 0; index < count; ++index)
+        {
+            new (dest + index) T(std::move(source[index]));
+            source[index].~T();
+        }
+    }
+}
+
+//Same as relocate(), for shifting objects within one buffer: the ranges may
+//overlap, and what's left of source outside dest becomes raw memory
+template <typename T>
+void relocateOverlapping(T* source, int count, T* dest) noexcept
+{
+    if (count <= 0 || source == dest)
+        return;
+
+    if constexpr (isTriviallyRelocatable<T>())
+        std::memmove((void*) dest, (const void*) source, sizeof(T) * (size_t) count);
+    else if (dest < source)
+        relocate(source, count, dest);
+    else
+    {
+        for (int index = count - 1; index >= 0; --index)
+        {
+            new (dest + index) T(std::move(source[index]));
+            source[index].~T();
+        }
+    }
+}
+} // namespace Relocation
+} // namespace EA
@@ -24,13 +24,24 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Utilities/TupleUtilities.h"
 #include "Utilities/StaticObjects.h"
 #include "Utilities/GenericUtilities.h"
+#include "Utilities/SIMD.h"
+#include "Utilities/ThreadPool.h"
+#include "Utilities/Execution.h"
 
 #include "Structures/FixedDynamicArray.h"
 
 #include "Structures/OwnedVector.h"
 #include "Structures/MapVector.h"
+#include "Structures/SortedMapVector.h"
+#include "Structures/SplitMapVector.h"
+#include "Structures/FlatHashMap.h"
+#include "Structures/SPSCQueue.h"
+#include "Structures/MPMCQueue.h"
+#include "Structures/LeftRight.h"
 #include "Structures/SharedGUIData.h"
 #include "Structures/CircularBuffer.h"
+#include "Structures/CircularInterpolation.h"
+#include "Structures/MirroredCircularBuffer.h"
 #include "Structures/BufferView.h"
 #include "Structures/Filtered.h"
 #include "Structures/SpecialVectors.h"
@@ -38,13 +49,21 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Structures/SmallVector.h"
 #include "Structures/MultiVector.h"
 #include "Structures/CopyOnWrite.h"
+#include "Structures/AtomicCopyOnWrite.h"
 
 #include "Flags/SpinHint.h"
+#include "Flags/CacheLine.h"
 #include "Flags/Locks.h"
+#include "Flags/LockInstrumentation.h"
 #include "Flags/RecursiveSpinLock.h"
+#include "Flags/SeqLock.h"
 
 #include "ValueWrapper/Value.h"
 #include "ValueWrapper/Constructed.h"
+#include "ValueWrapper/Relocation.h"
 
 #include "Allocators/PMR.h"
-#include "Allocators/MultiPoolAllocator.h"
\ No newline at end of file
+#include "Allocators/DefaultInitAllocator.h"
+#include "Allocators/Arena.h"
+#include "Allocators/MultiPoolAllocator.h"
+#include "Allocators/ConcurrentPoolResource.h"
\ No newline at end of file